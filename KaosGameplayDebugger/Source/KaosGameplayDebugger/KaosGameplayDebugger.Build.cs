@@ -43,7 +43,9 @@ public class KaosGameplayDebugger : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"Sockets",
+				"Networking"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -56,6 +58,9 @@ public class KaosGameplayDebugger : ModuleRules
 			}
 			);
 
+		// Defines UE_WITH_IRIS and pulls in IrisCore when the target has Iris enabled
+		SetupIrisSupport(Target);
+
 		if (Target.bBuildEditor)
 		{
 			PublicDependencyModuleNames.Add("ToolMenus");
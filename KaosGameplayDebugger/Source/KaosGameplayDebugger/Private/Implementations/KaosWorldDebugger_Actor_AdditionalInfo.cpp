@@ -40,6 +40,14 @@ void FKaosWorldDebugger_Actor_AdditionalInfo::DrawDetails(const FKaosDebuggerCon
 	}
 }
 
+void FKaosWorldDebugger_Actor_AdditionalInfo::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	if (IKaosGameplayDebuggerInfoProviderInterface* Info = Cast<IKaosGameplayDebuggerInfoProviderInterface>(Context.ContextObject.Get()))
+	{
+		Info->GetKaosDebugLines(OutLines);
+	}
+}
+
 FSlateIcon FKaosWorldDebugger_Actor_AdditionalInfo::GetTabIcon() const
 {
 	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "StaticMeshEditor.SetDrawAdditionalData");
@@ -35,6 +35,19 @@ void FKaosWorldDebugger_Actor_Details::DrawDetails(const FKaosDebuggerContext& C
 	SlateIM::Text(FString::Printf(TEXT("Class: %s"), *SelectedActor->GetClass()->GetName()));
 }
 
+void FKaosWorldDebugger_Actor_Details::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	AActor* SelectedActor = Cast<AActor>(Context.ContextObject.Get());
+
+	if (!SelectedActor)
+	{
+		return;
+	}
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Selected Actor"), SelectedActor->GetName()));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Location"), SelectedActor->GetActorLocation().ToString()));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Class"), SelectedActor->GetClass()->GetName()));
+}
+
 FSlateIcon FKaosWorldDebugger_Actor_Details::GetTabIcon() const
 {
 	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "WorldPartition.ShowActors");
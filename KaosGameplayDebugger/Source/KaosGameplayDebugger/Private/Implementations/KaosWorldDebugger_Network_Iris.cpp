@@ -0,0 +1,367 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Implementations/KaosWorldDebugger_Network_Iris.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "Engine/World.h"
+#include "KaosSlateIMHelpers.h"
+#if UE_WITH_IRIS
+#include "Iris/ReplicationSystem/ObjectReplicationBridge.h"
+#include "Iris/ReplicationSystem/ReplicationProtocol.h"
+#include "Iris/ReplicationSystem/ReplicationSystem.h"
+#endif
+
+void FKaosWorldDebugger_Network_Iris::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	if (!World->GetNetDriver())
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::WarningText(TEXT("World has no NetDriver."));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	FKaosReplicationStatsCache& Cache = CachedStats.FindOrAdd(World);
+	GatherIfNeeded(World, Cache, Context.DeltaTime);
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	KaosSlateIM::SubHeaderText(TEXT("Overview"));
+	KaosSlateIM::DrawLabledText(TEXT("Replication"), Cache.bUsingIris ? TEXT("Iris") : TEXT("Legacy"));
+	KaosSlateIM::DrawLabledText(TEXT("Replicated Actors"), FString::FromInt(Cache.ReplicatedObjectCount));
+	KaosSlateIM::DrawLabledText(TEXT("Replicated Components"), FString::FromInt(Cache.ReplicatedSubObjectCount));
+	if (Cache.bUsingIris)
+	{
+		KaosSlateIM::DrawLabledText(TEXT("Replication Protocols"), FString::FromInt(Cache.ProtocolCount));
+	}
+	else
+	{
+		KaosSlateIM::DrawLabledText(TEXT("Active Objects"), FString::FromInt(Cache.ActiveObjectCount));
+		KaosSlateIM::DrawLabledText(TEXT("Dormant Objects"), FString::FromInt(Cache.DormantObjectCount));
+	}
+
+	KaosSlateIM::HeaderText(TEXT("Replicated Classes"));
+	DrawClassTable(Cache);
+
+	SlateIM::BeginHorizontalStack();
+	KaosSlateIM::HeaderText(TEXT("Net Stats"));
+	if (SlateIM::Button(TEXT("Toggle 'stat Net'")) && GEngine)
+	{
+		GEngine->Exec(World, TEXT("stat Net"));
+	}
+	SlateIM::EndHorizontalStack();
+	DrawStatTable(Cache.NetStats);
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+void FKaosWorldDebugger_Network_Iris::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World || !World->GetNetDriver())
+	{
+		return;
+	}
+
+	FKaosReplicationStatsCache& Cache = CachedStats.FindOrAdd(World);
+	GatherIfNeeded(World, Cache, Context.DeltaTime);
+
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Replication"), Cache.bUsingIris ? TEXT("Iris") : TEXT("Legacy")));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Replicated Actors"), FString::FromInt(Cache.ReplicatedObjectCount)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Replicated Components"), FString::FromInt(Cache.ReplicatedSubObjectCount)));
+	if (Cache.bUsingIris)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(TEXT("Replication Protocols"), FString::FromInt(Cache.ProtocolCount)));
+	}
+
+	OutLines.Add(FKaosDebugLine::Separator());
+	for (const FKaosReplicatedClassInfo& Info : Cache.Classes)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(Info.ClassName, Cache.bUsingIris
+			? FString::Printf(TEXT("%d objects, %llu state bytes"), Info.ObjectCount, Info.TotalStateBytes)
+			: FString::Printf(TEXT("%d objects"), Info.ObjectCount)));
+	}
+}
+
+void FKaosWorldDebugger_Network_Iris::GatherIfNeeded(UWorld* World, FKaosReplicationStatsCache& Cache, float DeltaTime)
+{
+	Cache.TimeSinceLastGather += DeltaTime;
+	if (Cache.TimeSinceLastGather < RefreshInterval)
+	{
+		return;
+	}
+	Cache.TimeSinceLastGather = 0;
+
+	UNetDriver* NetDriver = World->GetNetDriver();
+	if (!NetDriver)
+	{
+		return;
+	}
+
+	Cache.ReplicatedObjectCount = 0;
+	Cache.ReplicatedSubObjectCount = 0;
+	Cache.ProtocolCount = 0;
+	Cache.ActiveObjectCount = 0;
+	Cache.DormantObjectCount = 0;
+	Cache.Classes.Reset();
+
+	Cache.bUsingIris = NetDriver->IsUsingIrisReplication();
+	if (Cache.bUsingIris)
+	{
+		GatherIris(World, NetDriver, Cache);
+	}
+	else
+	{
+		GatherLegacy(NetDriver, Cache);
+	}
+
+	Cache.Classes.Sort([](const FKaosReplicatedClassInfo& A, const FKaosReplicatedClassInfo& B)
+	{
+		return A.ObjectCount > B.ObjectCount;
+	});
+
+	GatherStats(Cache);
+}
+
+void FKaosWorldDebugger_Network_Iris::GatherIris(UWorld* World, UNetDriver* NetDriver, FKaosReplicationStatsCache& Cache)
+{
+#if UE_WITH_IRIS
+	UReplicationSystem* ReplicationSystem = NetDriver->GetReplicationSystem();
+	UObjectReplicationBridge* Bridge = ReplicationSystem ? ReplicationSystem->GetReplicationBridgeAs<UObjectReplicationBridge>() : nullptr;
+	if (!Bridge)
+	{
+		return;
+	}
+
+	TMap<UClass*, FKaosReplicatedClassInfo> ClassInfos;
+	TMap<UClass*, TSet<UE::Net::FReplicationProtocolIdentifier>> ClassProtocols;
+	TSet<UE::Net::FReplicationProtocolIdentifier> AllProtocols;
+
+	// Only objects the bridge has a handle for are actually replicated by Iris
+	auto AddObject = [&](UObject* Object) -> bool
+	{
+		const UE::Net::FNetRefHandle Handle = Bridge->GetReplicatedRefHandle(Object);
+		if (!Handle.IsValid())
+		{
+			return false;
+		}
+
+		UClass* Class = Object->GetClass();
+		FKaosReplicatedClassInfo& Info = ClassInfos.FindOrAdd(Class);
+		++Info.ObjectCount;
+
+		if (const UE::Net::FReplicationProtocol* Protocol = ReplicationSystem->GetReplicationProtocol(Handle))
+		{
+			ClassProtocols.FindOrAdd(Class).Add(Protocol->ProtocolIdentifier);
+			AllProtocols.Add(Protocol->ProtocolIdentifier);
+			++Info.ProtocolObjectCount;
+			Info.TotalStateCount += Protocol->ReplicationStateCount;
+			Info.TotalChangeMaskBits += Protocol->ChangeMaskBitCount;
+			Info.TotalStateBytes += Protocol->InternalTotalSize;
+		}
+		return true;
+	};
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!Actor->GetIsReplicated() || !AddObject(Actor))
+		{
+			continue;
+		}
+
+		++Cache.ReplicatedObjectCount;
+		Actor->ForEachComponent(false, [&](UActorComponent* Component)
+		{
+			if (Component->GetIsReplicated() && AddObject(Component))
+			{
+				++Cache.ReplicatedSubObjectCount;
+			}
+		});
+	}
+
+	Cache.ProtocolCount = AllProtocols.Num();
+	for (auto& Pair : ClassInfos)
+	{
+		Pair.Value.ClassName = GetNameSafe(Pair.Key);
+		if (const TSet<UE::Net::FReplicationProtocolIdentifier>* Protocols = ClassProtocols.Find(Pair.Key))
+		{
+			Pair.Value.ProtocolCount = Protocols->Num();
+		}
+		Cache.Classes.Add(MoveTemp(Pair.Value));
+	}
+#endif
+}
+
+void FKaosWorldDebugger_Network_Iris::GatherLegacy(UNetDriver* NetDriver, FKaosReplicationStatsCache& Cache)
+{
+	const FNetworkObjectList& NetworkObjects = NetDriver->GetNetworkObjectList();
+	Cache.ActiveObjectCount = NetworkObjects.GetActiveObjects().Num();
+	Cache.DormantObjectCount = NetworkObjects.GetDormantObjectsOnAllConnections().Num();
+
+	TMap<UClass*, FKaosReplicatedClassInfo> ClassInfos;
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : NetworkObjects.GetAllObjects())
+	{
+		AActor* Actor = ObjectInfo.IsValid() ? ObjectInfo->Actor : nullptr;
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		++Cache.ReplicatedObjectCount;
+		++ClassInfos.FindOrAdd(Actor->GetClass()).ObjectCount;
+
+		Actor->ForEachComponent(false, [&](UActorComponent* Component)
+		{
+			if (Component->GetIsReplicated())
+			{
+				++Cache.ReplicatedSubObjectCount;
+				++ClassInfos.FindOrAdd(Component->GetClass()).ObjectCount;
+			}
+		});
+	}
+
+	for (auto& Pair : ClassInfos)
+	{
+		Pair.Value.ClassName = GetNameSafe(Pair.Key);
+		Cache.Classes.Add(MoveTemp(Pair.Value));
+	}
+}
+
+void FKaosWorldDebugger_Network_Iris::GatherStats(FKaosReplicationStatsCache& Cache)
+{
+	Cache.NetStats.Reset();
+	KaosDebuggerStats::GetGroupStats(TEXT("STATGROUP_Net"), Cache.NetStats);
+}
+
+void FKaosWorldDebugger_Network_Iris::DrawClassTable(const FKaosReplicationStatsCache& Cache)
+{
+	SlateIM::MaxHeight(600.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(240.f); SlateIM::AddTableColumn(TEXT("Class"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Objects"));
+	if (Cache.bUsingIris)
+	{
+		SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Protocols"));
+		SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Avg States"));
+		SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Avg Change Bits"));
+		SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Avg State Bytes"));
+		SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Total Bytes"));
+	}
+
+	for (const FKaosReplicatedClassInfo& Info : Cache.Classes)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Info.ClassName);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(Info.ObjectCount));
+		}
+		if (!Cache.bUsingIris)
+		{
+			continue;
+		}
+
+		// A class can end up with several protocols, so per object figures are averages over the instances
+		const double ProtocolObjects = FMath::Max(Info.ProtocolObjectCount, 1);
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(Info.ProtocolCount));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::Printf(TEXT("%.1f"), Info.TotalStateCount / ProtocolObjects));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::Printf(TEXT("%.1f"), Info.TotalChangeMaskBits / ProtocolObjects));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::Printf(TEXT("%.0f"), Info.TotalStateBytes / ProtocolObjects));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::Printf(TEXT("%llu"), Info.TotalStateBytes));
+		}
+	}
+
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_Network_Iris::DrawStatTable(const TArray<FKaosStatValue>& Stats)
+{
+	if (Stats.IsEmpty())
+	{
+		SlateIM::Text(KaosDebuggerStats::AreStatsAvailable() ? TEXT("Stat group not enabled.") : TEXT("Stats are compiled out."));
+		return;
+	}
+
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Stat"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Average"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Max"));
+
+	for (const FKaosStatValue& Stat : Stats)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Stat.Description.IsEmpty() ? Stat.StatName.ToString() : Stat.Description);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Stat.bIsCycle ? FString::Printf(TEXT("%.3f ms"), Stat.Average) : FString::Printf(TEXT("%.0f"), Stat.Average));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Stat.bIsCycle ? FString::Printf(TEXT("%.3f ms"), Stat.Max) : FString::Printf(TEXT("%.0f"), Stat.Max));
+		}
+	}
+
+	SlateIM::EndTable();
+}
+
+FSlateIcon FKaosWorldDebugger_Network_Iris::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.StatsViewer");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,411 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Implementations/KaosWorldDebugger_Network_SubObjects.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "KaosSlateIMHelpers.h"
+#include "UObject/UObjectHash.h"
+
+FKaosWorldDebugger_Network_SubObjects::FKaosWorldDebugger_Network_SubObjects()
+	: Census(
+		[this](const TWeakObjectPtr<AActor>& Actor, FKaosCensusResult& Result) { ProcessActor(Actor, Result); },
+		[this](FKaosCensusResult& Result)
+		{
+			Result.Classes.Sort([](const FKaosClassCensus& A, const FKaosClassCensus& B)
+			{
+				return A.Components + A.SubObjects > B.Components + B.SubObjects;
+			});
+			Result.ClassIndices.Reset();
+
+			// Reinstanced or unloaded classes would otherwise pile up over a long session
+			for (auto It = ClassLayouts.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+		},
+		[](const AActor* Actor) { return Actor->GetIsReplicated(); })
+{
+}
+
+void FKaosWorldDebugger_Network_SubObjects::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	TickCensus(World, Context.DeltaTime);
+	const FKaosCensusResult& Result = Census.GetResults();
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	Census.DrawControls();
+
+	if (!Census.HasResults())
+	{
+		SlateIM::Text(TEXT("Waiting for first census pass..."));
+		SlateIM::EndVerticalStack();
+		SlateIM::EndScrollBox();
+		return;
+	}
+
+	KaosSlateIM::DrawLabledText(TEXT("Replicated Actors"), FString::FromInt(Result.TotalActors));
+	KaosSlateIM::DrawLabledText(TEXT("Replicated Components"), FString::FromInt(Result.TotalComponents));
+	KaosSlateIM::DrawLabledText(TEXT("Registered SubObjects"), FString::FromInt(Result.TotalSubObjects));
+
+	KaosSlateIM::HeaderText(TEXT("Classes"));
+	DrawClassTable(Result);
+
+	const FKaosClassCensus* SelectedClassCensus = SelectedClass.IsValid()
+		? Result.Classes.FindByPredicate([this](const FKaosClassCensus& ClassCensus) { return ClassCensus.Class == SelectedClass; })
+		: nullptr;
+	if (SelectedClassCensus)
+	{
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::BeginHorizontalStack();
+		SlateIM::Fill();
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::HeaderText(SelectedClassCensus->ClassName);
+		DrawActorTable(*SelectedClassCensus);
+		SlateIM::EndVerticalStack();
+
+		SlateIM::Fill();
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::BeginVerticalStack();
+		DrawSelectedActor();
+		SlateIM::EndVerticalStack();
+		SlateIM::EndHorizontalStack();
+	}
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+void FKaosWorldDebugger_Network_SubObjects::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		return;
+	}
+
+	TickCensus(World, Context.DeltaTime);
+	if (!Census.HasResults())
+	{
+		return;
+	}
+
+	const FKaosCensusResult& Result = Census.GetResults();
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Replicated Actors"), FString::FromInt(Result.TotalActors)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Replicated Components"), FString::FromInt(Result.TotalComponents)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Registered SubObjects"), FString::FromInt(Result.TotalSubObjects)));
+	for (const FKaosClassCensus& ClassCensus : Result.Classes)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(ClassCensus.ClassName, FString::Printf(TEXT("%d actors, %d components, %d subobjects, %s"),
+			ClassCensus.ActorCount, ClassCensus.Components, ClassCensus.SubObjects,
+			ClassCensus.bUsesRegisteredList ? TEXT("Registered List") : TEXT("ReplicateSubobjects"))));
+	}
+}
+
+void FKaosWorldDebugger_Network_SubObjects::TickCensus(UWorld* World, float DeltaTime)
+{
+	if (CensusWorld != World)
+	{
+		CensusWorld = World;
+		SelectedClass.Reset();
+		SelectedActor.Reset();
+	}
+
+	Census.Tick(World, DeltaTime);
+}
+
+void FKaosWorldDebugger_Network_SubObjects::ProcessActor(const TWeakObjectPtr<AActor>& WeakActor, FKaosCensusResult& Result)
+{
+	AActor* Actor = WeakActor.Get();
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	UClass* Class = Actor->GetClass();
+	const FKaosClassLayout& ActorLayout = GetClassLayout(Class);
+
+	FKaosActorCensus ActorCensus;
+	ActorCensus.Actor = Actor;
+	ActorCensus.ActorName = Actor->GetName();
+	ActorCensus.RepProperties = ActorLayout.NumRepProperties;
+
+	Actor->ForEachComponent(false, [&](UActorComponent* Component)
+	{
+		if (!Component->GetIsReplicated())
+		{
+			return;
+		}
+
+		const FKaosClassLayout& ComponentLayout = GetClassLayout(Component->GetClass());
+		++ActorCensus.Components;
+		ActorCensus.RepProperties += ComponentLayout.NumRepProperties;
+		if (!ComponentLayout.bUsesRegisteredList)
+		{
+			++ActorCensus.LegacyComponents;
+		}
+	});
+	ActorCensus.SubObjects = CountRegisteredSubObjects(Actor);
+
+	int32& ClassIndex = Result.ClassIndices.FindOrAdd(Class, INDEX_NONE);
+	if (ClassIndex == INDEX_NONE)
+	{
+		ClassIndex = Result.Classes.AddDefaulted();
+		Result.Classes[ClassIndex].Class = Class;
+		Result.Classes[ClassIndex].ClassName = Class->GetName();
+		Result.Classes[ClassIndex].bUsesRegisteredList = ActorLayout.bUsesRegisteredList;
+	}
+
+	FKaosClassCensus& ClassCensus = Result.Classes[ClassIndex];
+	++ClassCensus.ActorCount;
+	ClassCensus.Components += ActorCensus.Components;
+	ClassCensus.LegacyComponents += ActorCensus.LegacyComponents;
+	ClassCensus.SubObjects += ActorCensus.SubObjects;
+	ClassCensus.RepProperties += ActorCensus.RepProperties;
+
+	++Result.TotalActors;
+	Result.TotalComponents += ActorCensus.Components;
+	Result.TotalSubObjects += ActorCensus.SubObjects;
+
+	ClassCensus.Actors.Add(MoveTemp(ActorCensus));
+}
+
+const FKaosWorldDebugger_Network_SubObjects::FKaosClassLayout& FKaosWorldDebugger_Network_SubObjects::GetClassLayout(UClass* Class)
+{
+	if (const FKaosClassLayout* Found = ClassLayouts.Find(Class))
+	{
+		return *Found;
+	}
+
+	// Registered list usage is set in constructors, so the CDO answers for every instance of the class
+	FKaosClassLayout Layout;
+	UObject* DefaultObject = Class->GetDefaultObject(false);
+	if (const AActor* DefaultActor = Cast<AActor>(DefaultObject))
+	{
+		Layout.bUsesRegisteredList = DefaultActor->IsUsingRegisteredSubObjectList();
+	}
+	else if (const UActorComponent* DefaultComponent = Cast<UActorComponent>(DefaultObject))
+	{
+		Layout.bUsesRegisteredList = DefaultComponent->IsUsingRegisteredSubObjectList();
+	}
+	Layout.NumRepProperties = Class->ClassReps.Num();
+
+	return ClassLayouts.Add(Class, Layout);
+}
+
+int32 FKaosWorldDebugger_Network_SubObjects::CountRegisteredSubObjects(AActor* Actor, TArray<FString>* OutNames)
+{
+	TArray<UActorComponent*> ReplicatedComponents;
+	Actor->ForEachComponent(false, [&ReplicatedComponents](UActorComponent* Component)
+	{
+		if (Component->GetIsReplicated())
+		{
+			ReplicatedComponents.Add(Component);
+		}
+	});
+
+	// Subobjects are usually outered to the actor even when a component registers them (e.g. attribute sets)
+	int32 Count = 0;
+	ForEachObjectWithOuter(Actor, [&](UObject* Object)
+	{
+		if (Object->IsA<UActorComponent>())
+		{
+			return;
+		}
+
+		const UActorComponent* RegisteredBy = nullptr;
+		bool bRegistered = Actor->IsReplicatedSubObjectRegistered(Object);
+		for (int32 Index = 0; !bRegistered && Index < ReplicatedComponents.Num(); ++Index)
+		{
+			if (Actor->IsActorComponentReplicatedSubObjectRegistered(ReplicatedComponents[Index], Object))
+			{
+				bRegistered = true;
+				RegisteredBy = ReplicatedComponents[Index];
+			}
+		}
+
+		if (bRegistered)
+		{
+			++Count;
+			if (OutNames)
+			{
+				OutNames->Add(RegisteredBy
+					? FString::Printf(TEXT("%s (%s)"), *Object->GetName(), *RegisteredBy->GetName())
+					: Object->GetName());
+			}
+		}
+	}, true);
+
+	return Count;
+}
+
+void FKaosWorldDebugger_Network_SubObjects::DrawClassTable(const FKaosCensusResult& Result)
+{
+	SlateIM::MaxHeight(500.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(240.f); SlateIM::AddTableColumn(TEXT("Class"));
+	SlateIM::InitialTableColumnWidth(140.f); SlateIM::AddTableColumn(TEXT("SubObject Mode"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Actors"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Components"));
+	SlateIM::InitialTableColumnWidth(110.f); SlateIM::AddTableColumn(TEXT("Legacy Comps"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("SubObjects"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Rep Props"));
+
+	for (const FKaosClassCensus& ClassCensus : Result.Classes)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			if (SlateIM::Button(ClassCensus.ClassName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+			{
+				SelectedClass = ClassCensus.Class;
+				SelectedActor.Reset();
+			}
+		}
+		if (SlateIM::NextTableCell())
+		{
+			if (ClassCensus.bUsesRegisteredList)
+			{
+				SlateIM::Text(TEXT("Registered List"));
+			}
+			else
+			{
+				SlateIM::Text(TEXT("ReplicateSubobjects"), FLinearColor::Yellow);
+			}
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ClassCensus.ActorCount));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ClassCensus.Components));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ClassCensus.LegacyComponents));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ClassCensus.SubObjects));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ClassCensus.RepProperties));
+		}
+	}
+
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_Network_SubObjects::DrawActorTable(const FKaosClassCensus& ClassCensus)
+{
+	SlateIM::MaxHeight(400.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Actor"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Components"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("SubObjects"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Rep Props"));
+
+	for (const FKaosActorCensus& ActorCensus : ClassCensus.Actors)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			if (SlateIM::Button(ActorCensus.ActorName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+			{
+				SelectedActor = ActorCensus.Actor;
+			}
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ActorCensus.Components));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ActorCensus.SubObjects));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(ActorCensus.RepProperties));
+		}
+	}
+
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_Network_SubObjects::DrawSelectedActor()
+{
+	AActor* Actor = SelectedActor.Get();
+	if (!Actor)
+	{
+		SlateIM::Text(TEXT("Select an actor to list its replicated components and subobjects."));
+		return;
+	}
+
+	// Only the selected actor is walked live, the census itself stays time sliced
+	KaosSlateIM::HeaderText(Actor->GetName());
+	KaosSlateIM::DrawLabledText(TEXT("SubObject Mode"), Actor->IsUsingRegisteredSubObjectList() ? TEXT("Registered List") : TEXT("ReplicateSubobjects"));
+
+	KaosSlateIM::SubHeaderText(TEXT("Replicated Components"));
+	Actor->ForEachComponent(false, [this](UActorComponent* Component)
+	{
+		if (Component->GetIsReplicated())
+		{
+			const FKaosClassLayout& Layout = GetClassLayout(Component->GetClass());
+			KaosSlateIM::DrawLabledText(Component->GetName(), FString::Printf(TEXT("%s, %d rep props, %s"),
+				*Component->GetClass()->GetName(), Layout.NumRepProperties,
+				Layout.bUsesRegisteredList ? TEXT("Registered List") : TEXT("ReplicateSubobjects")));
+		}
+	});
+
+	KaosSlateIM::SubHeaderText(TEXT("Registered SubObjects"));
+	TArray<FString> SubObjectNames;
+	CountRegisteredSubObjects(Actor, &SubObjectNames);
+	for (const FString& Name : SubObjectNames)
+	{
+		SlateIM::Text(Name);
+	}
+}
+
+FSlateIcon FKaosWorldDebugger_Network_SubObjects::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "ClassIcon.ActorComponent");
+
+	return MyIcon;
+}
+#endif
@@ -160,6 +160,34 @@ void FKaosWorldDebugger_World_Details::DrawDetails(const FKaosDebuggerContext& C
 	}
 }
 
+void FKaosWorldDebugger_World_Details::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		OutLines.Add(FKaosDebugLine::Error(TEXT("No World Selected")));
+		return;
+	}
+
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("World Name"), World->GetName()));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("World Type"), GetWorldTypeString(World->WorldType)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Actor Count"), FString::FromInt(World->GetActorCount())));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Time Seconds"), FString::Printf(TEXT("%.2f"), World->TimeSeconds)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Delta Seconds"), FString::Printf(TEXT("%.4f"), World->GetDeltaSeconds())));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Is Paused"), World->IsPaused() ? TEXT("Yes") : TEXT("No")));
+
+	FKaosNetworkStatsCache& Cache = CachedNetworkStats.FindOrAdd(Context.ContextWorld);
+	GatherNetworkStatsIfNeeded(World, Cache);
+
+	OutLines.Add(FKaosDebugLine::Separator());
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Net Mode"), GetNetModeString(World->GetNetMode())));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Replicated Actor Count"), FString::FromInt(Cache.LastReplicatedActorCount)));
+	for (const auto& Pair : Cache.CachedDormancyCounts)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(Pair.Key, FString::FromInt(Pair.Value)));
+	}
+}
+
 void FKaosWorldDebugger_World_Details::GatherNetworkStatsIfNeeded(UWorld* World, FKaosNetworkStatsCache& Cache)
 {
 	if (!IsValid(World)) return;
@@ -0,0 +1,295 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Implementations/KaosWorldDebugger_World_Matrix.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Async/ParallelFor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "KaosDebuggerWorldPicker.h"
+#include "KaosGameplayDebuggerModule.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_World_Matrix::~FKaosWorldDebugger_World_Matrix()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(TickStartHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+}
+
+void FKaosWorldDebugger_World_Matrix::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	BindTickDelegates();
+	RefreshColumns();
+	GatherDueColumns(Context.DeltaTime);
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::Text(TEXT("Column Interval (s):"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(RefreshInterval, 0.1f, 10.f);
+	SlateIM::EndHorizontalStack();
+
+	if (Columns.IsEmpty())
+	{
+		KaosSlateIM::WarningText(TEXT("No game worlds running."));
+		SlateIM::EndVerticalStack();
+		SlateIM::EndScrollBox();
+		return;
+	}
+
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(180.f); SlateIM::AddTableColumn(TEXT("Stat"));
+	for (const FKaosWorldColumn& Column : Columns)
+	{
+		SlateIM::InitialTableColumnWidth(180.f); SlateIM::AddTableColumn(Column.Label);
+	}
+
+	DrawRow(TEXT("Actors"), [](const FKaosWorldColumn& Column) { return FString::FromInt(Column.ActorCount); });
+	DrawRow(TEXT("Replicated"), [](const FKaosWorldColumn& Column) { return FString::FromInt(Column.ReplicatedCount); });
+
+	const UEnum* DormancyEnum = StaticEnum<ENetDormancy>();
+	for (int32 Dormancy = 0; Dormancy < DORM_MAX; ++Dormancy)
+	{
+		DrawRow(DormancyEnum->GetNameStringByValue(Dormancy), [Dormancy](const FKaosWorldColumn& Column)
+		{
+			return Column.DormancyCounts.IsValidIndex(Dormancy) ? FString::FromInt(Column.DormancyCounts[Dormancy]) : FString();
+		});
+	}
+
+	DrawRow(TEXT("Tick (ms)"), [this](const FKaosWorldColumn& Column)
+	{
+		const FKaosWorldTickTiming* Timing = TickTimings.Find(Column.World);
+		return Timing ? FString::Printf(TEXT("%.2f (avg %.2f)"), Timing->LastTickMs, Timing->AverageTickMs) : FString(TEXT("-"));
+	});
+
+	// Extension rows are matched by label, a world missing one just shows an empty cell
+	TArray<FString> ExtensionLabels;
+	for (const FKaosWorldColumn& Column : Columns)
+	{
+		for (const FKaosDebugLine& Line : Column.ExtensionLines)
+		{
+			ExtensionLabels.AddUnique(Line.Label);
+		}
+	}
+	for (const FString& ExtensionLabel : ExtensionLabels)
+	{
+		DrawRow(ExtensionLabel, [&ExtensionLabel](const FKaosWorldColumn& Column)
+		{
+			const FKaosDebugLine* Line = Column.ExtensionLines.FindByPredicate([&ExtensionLabel](const FKaosDebugLine& Item) { return Item.Label == ExtensionLabel; });
+			return Line ? Line->Value : FString();
+		});
+	}
+
+	SlateIM::EndTable();
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+void FKaosWorldDebugger_World_Matrix::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	BindTickDelegates();
+	RefreshColumns();
+	GatherDueColumns(Context.DeltaTime);
+
+	for (const FKaosWorldColumn& Column : Columns)
+	{
+		OutLines.Add(FKaosDebugLine::Text(Column.Label));
+		OutLines.Add(FKaosDebugLine::Pair(TEXT("Actors"), FString::FromInt(Column.ActorCount)));
+		OutLines.Add(FKaosDebugLine::Pair(TEXT("Replicated"), FString::FromInt(Column.ReplicatedCount)));
+		if (const FKaosWorldTickTiming* Timing = TickTimings.Find(Column.World))
+		{
+			OutLines.Add(FKaosDebugLine::Pair(TEXT("Tick (ms)"), FString::Printf(TEXT("%.2f"), Timing->AverageTickMs)));
+		}
+		OutLines.Append(Column.ExtensionLines);
+	}
+}
+
+void FKaosWorldDebugger_World_Matrix::BindTickDelegates()
+{
+	// Bound the first time the tab is used so an unopened matrix costs nothing per world tick
+	if (!TickStartHandle.IsValid())
+	{
+		TickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(this, &FKaosWorldDebugger_World_Matrix::OnWorldTickStart);
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FKaosWorldDebugger_World_Matrix::OnWorldPostActorTick);
+	}
+}
+
+void FKaosWorldDebugger_World_Matrix::RefreshColumns()
+{
+	TArray<UWorld*> Worlds;
+	FKaosDebuggerWorldPicker::GetDebuggableWorlds(Worlds);
+
+	const bool bChanged = Worlds.Num() != Columns.Num() || Columns.ContainsByPredicate([&Worlds](const FKaosWorldColumn& Column)
+	{
+		return !Worlds.Contains(Column.World.Get());
+	});
+	if (!bChanged)
+	{
+		return;
+	}
+
+	TArray<FKaosWorldColumn> NewColumns;
+	for (int32 Index = 0; Index < Worlds.Num(); ++Index)
+	{
+		FKaosWorldColumn* Existing = Columns.FindByPredicate([World = Worlds[Index]](const FKaosWorldColumn& Column) { return Column.World == World; });
+		FKaosWorldColumn& Column = Existing ? NewColumns.Add_GetRef(MoveTemp(*Existing)) : NewColumns.AddDefaulted_GetRef();
+		Column.World = Worlds[Index];
+		Column.Label = FKaosDebuggerWorldPicker::GetWorldLabel(Worlds[Index]);
+		// Stagger the columns across the interval so worlds don't all gather on the same frame
+		Column.TimeUntilGather = RefreshInterval * Index / Worlds.Num();
+	}
+	Columns = MoveTemp(NewColumns);
+
+	for (auto It = TickTimings.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FKaosWorldDebugger_World_Matrix::GatherDueColumns(float DeltaTime)
+{
+	FKaosGameplayDebuggerModule& Module = FKaosGameplayDebuggerModule::Get();
+
+	for (FKaosWorldColumn& Column : Columns)
+	{
+		const bool bFirstGather = !Column.bHasData;
+		Column.TimeUntilGather -= DeltaTime;
+		if (Column.TimeUntilGather > 0 && !bFirstGather)
+		{
+			continue;
+		}
+
+		UWorld* World = Column.World.Get();
+		if (!World)
+		{
+			continue;
+		}
+
+		// A new column fills straight away but keeps its stagger offset for the following gathers
+		Column.TimeUntilGather = bFirstGather ? Column.TimeUntilGather + RefreshInterval : RefreshInterval;
+		Column.bHasData = true;
+		GatherActorCounts(World, Column);
+
+		Column.ExtensionLines.Reset();
+		Module.OnCollectWorldStats().Broadcast(World, Column.ExtensionLines);
+	}
+}
+
+void FKaosWorldDebugger_World_Matrix::GatherActorCounts(UWorld* World, FKaosWorldColumn& Column)
+{
+	TArray<AActor*> Actors;
+	for (const ULevel* Level : World->GetLevels())
+	{
+		if (!Level)
+		{
+			continue;
+		}
+
+		Actors.Reserve(Actors.Num() + Level->Actors.Num());
+		for (AActor* Actor : Level->Actors)
+		{
+			Actors.Add(Actor);
+		}
+	}
+
+	struct FActorCounts
+	{
+		int32 Actors = 0;
+		int32 Replicated = 0;
+		int32 Dormancy[DORM_MAX] = {};
+	};
+
+	// Only reads flags that nothing writes while the game thread is blocked here
+	TArray<FActorCounts> Counts;
+	ParallelForWithTaskContext(TEXT("KaosWorldMatrix"), Counts, Actors.Num(), 512, [&Actors](FActorCounts& TaskCounts, int32 Index)
+	{
+		const AActor* Actor = Actors[Index];
+		if (!IsValid(Actor))
+		{
+			return;
+		}
+
+		++TaskCounts.Actors;
+		if (Actor->GetIsReplicated())
+		{
+			++TaskCounts.Replicated;
+			++TaskCounts.Dormancy[FMath::Clamp<int32>(Actor->NetDormancy, 0, DORM_MAX - 1)];
+		}
+	});
+
+	Column.ActorCount = 0;
+	Column.ReplicatedCount = 0;
+	Column.DormancyCounts.Init(0, DORM_MAX);
+	for (const FActorCounts& TaskCounts : Counts)
+	{
+		Column.ActorCount += TaskCounts.Actors;
+		Column.ReplicatedCount += TaskCounts.Replicated;
+		for (int32 Dormancy = 0; Dormancy < DORM_MAX; ++Dormancy)
+		{
+			Column.DormancyCounts[Dormancy] += TaskCounts.Dormancy[Dormancy];
+		}
+	}
+}
+
+void FKaosWorldDebugger_World_Matrix::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	TickTimings.FindOrAdd(World).TickStartTime = FPlatformTime::Seconds();
+}
+
+void FKaosWorldDebugger_World_Matrix::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (FKaosWorldTickTiming* Timing = TickTimings.Find(World))
+	{
+		Timing->LastTickMs = (FPlatformTime::Seconds() - Timing->TickStartTime) * 1000.0;
+		Timing->AverageTickMs = FMath::Lerp(Timing->AverageTickMs, Timing->LastTickMs, 0.1);
+	}
+}
+
+void FKaosWorldDebugger_World_Matrix::DrawRow(const FString& Label, TFunctionRef<FString(const FKaosWorldColumn&)> GetValue)
+{
+	if (SlateIM::NextTableCell())
+	{
+		SlateIM::Text(Label);
+	}
+	for (const FKaosWorldColumn& Column : Columns)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Column.bHasData ? GetValue(Column) : FString(TEXT("...")));
+		}
+	}
+}
+
+FSlateIcon FKaosWorldDebugger_World_Matrix::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.Levels");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,97 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosDebuggerHistogram.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+
+FKaosLogHistogram::FKaosLogHistogram(double InMinValue)
+	: MinValue(FMath::Max(InMinValue, UE_DOUBLE_SMALL_NUMBER))
+{
+	Reset();
+}
+
+void FKaosLogHistogram::Add(double Value)
+{
+	++Buckets[GetBucketIndex(Value)];
+	Min = Count > 0 ? FMath::Min(Min, Value) : Value;
+	Max = Count > 0 ? FMath::Max(Max, Value) : Value;
+	Sum += Value;
+	++Count;
+}
+
+void FKaosLogHistogram::Reset()
+{
+	FMemory::Memzero(Buckets);
+	Count = 0;
+	Sum = 0.0;
+	Min = 0.0;
+	Max = 0.0;
+}
+
+double FKaosLogHistogram::GetPercentile(double Percentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const int32 Target = FMath::Max(1, FMath::CeilToInt32(FMath::Clamp(Percentile, 0.0, 1.0) * Count));
+	int32 Running = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		Running += Buckets[BucketIndex];
+		if (Running >= Target)
+		{
+			// The bucket bound can overshoot the largest value actually seen
+			return FMath::Min(GetBucketUpperBound(BucketIndex), Max);
+		}
+	}
+	return Max;
+}
+
+int32 FKaosLogHistogram::GetLargestBucketCount() const
+{
+	int32 Largest = 0;
+	for (int32 BucketCount : Buckets)
+	{
+		Largest = FMath::Max(Largest, BucketCount);
+	}
+	return Largest;
+}
+
+double FKaosLogHistogram::GetBucketLowerBound(int32 BucketIndex) const
+{
+	return BucketIndex == 0 ? 0.0 : MinValue * FMath::Pow(2.0, BucketIndex - 1);
+}
+
+double FKaosLogHistogram::GetBucketUpperBound(int32 BucketIndex) const
+{
+	return BucketIndex == NumBuckets - 1 ? UE_DOUBLE_BIG_NUMBER : MinValue * FMath::Pow(2.0, BucketIndex);
+}
+
+int32 FKaosLogHistogram::GetBucketIndex(double Value) const
+{
+	if (Value < MinValue)
+	{
+		return 0;
+	}
+	return FMath::Min(1 + FMath::FloorToInt32(FMath::Log2(Value / MinValue)), NumBuckets - 1);
+}
+#endif
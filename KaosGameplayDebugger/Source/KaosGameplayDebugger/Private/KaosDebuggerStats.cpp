@@ -0,0 +1,150 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosDebuggerStats.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Stats/StatsData.h"
+
+namespace KaosDebuggerStats
+{
+#if STATS
+	static void ToStatValue(const FComplexStatMessage& Message, FKaosStatValue& OutValue)
+	{
+		OutValue.StatName = Message.NameAndInfo.GetShortName();
+		OutValue.Description = Message.NameAndInfo.GetDescription();
+		OutValue.bIsCycle = Message.NameAndInfo.GetFlag(EStatMetaFlags::IsCycle);
+
+		if (OutValue.bIsCycle)
+		{
+			OutValue.Average = FPlatformTime::ToMilliseconds(Message.GetValue_Duration(EComplexStatField::IncAve));
+			OutValue.Max = FPlatformTime::ToMilliseconds(Message.GetValue_Duration(EComplexStatField::IncMax));
+			OutValue.CallCount = Message.GetValue_CallCount(EComplexStatField::IncAve);
+		}
+		else if (Message.NameAndInfo.GetField<EStatDataType>() == EStatDataType::ST_double)
+		{
+			OutValue.Average = Message.GetValue_double(EComplexStatField::IncAve);
+			OutValue.Max = Message.GetValue_double(EComplexStatField::IncMax);
+		}
+		else
+		{
+			OutValue.Average = static_cast<double>(Message.GetValue_int64(EComplexStatField::IncAve));
+			OutValue.Max = static_cast<double>(Message.GetValue_int64(EComplexStatField::IncMax));
+		}
+	}
+
+	static void ForEachActiveGroup(TFunctionRef<bool(FName, const FActiveStatGroupInfo&)> Callback)
+	{
+		const FGameThreadStatsData* StatsData = FLatestGameThreadStatsData::Get().Latest;
+		if (!StatsData)
+		{
+			return;
+		}
+
+		for (int32 GroupIdx = 0; GroupIdx < StatsData->ActiveStatGroups.Num(); ++GroupIdx)
+		{
+			const FName GroupName = StatsData->GroupNames.IsValidIndex(GroupIdx) ? StatsData->GroupNames[GroupIdx] : NAME_None;
+			if (!Callback(GroupName, StatsData->ActiveStatGroups[GroupIdx]))
+			{
+				return;
+			}
+		}
+	}
+#endif
+
+	bool AreStatsAvailable()
+	{
+#if STATS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	bool IsGroupActive(FName GroupName)
+	{
+		bool bFound = false;
+#if STATS
+		ForEachActiveGroup([&](FName ActiveGroupName, const FActiveStatGroupInfo&)
+		{
+			bFound = ActiveGroupName == GroupName;
+			return !bFound;
+		});
+#endif
+		return bFound;
+	}
+
+	void GetActiveGroupNames(TArray<FName>& OutGroupNames)
+	{
+#if STATS
+		ForEachActiveGroup([&](FName ActiveGroupName, const FActiveStatGroupInfo&)
+		{
+			OutGroupNames.Add(ActiveGroupName);
+			return true;
+		});
+#endif
+	}
+
+	bool FindStat(FName StatName, FKaosStatValue& OutValue)
+	{
+		bool bFound = false;
+#if STATS
+		ForEachActiveGroup([&](FName, const FActiveStatGroupInfo& Group)
+		{
+			for (const TArray<FComplexStatMessage>* Messages : { &Group.FlatAggregate, &Group.CountersAggregate })
+			{
+				for (const FComplexStatMessage& Message : *Messages)
+				{
+					if (Message.NameAndInfo.GetShortName() == StatName)
+					{
+						ToStatValue(Message, OutValue);
+						bFound = true;
+						return false;
+					}
+				}
+			}
+			return true;
+		});
+#endif
+		return bFound;
+	}
+
+	void GetGroupStats(FName GroupName, TArray<FKaosStatValue>& OutValues)
+	{
+#if STATS
+		ForEachActiveGroup([&](FName ActiveGroupName, const FActiveStatGroupInfo& Group)
+		{
+			if (ActiveGroupName != GroupName)
+			{
+				return true;
+			}
+
+			for (const TArray<FComplexStatMessage>* Messages : { &Group.FlatAggregate, &Group.CountersAggregate })
+			{
+				for (const FComplexStatMessage& Message : *Messages)
+				{
+					ToStatValue(Message, OutValues.AddDefaulted_GetRef());
+				}
+			}
+			return false;
+		});
+#endif
+	}
+}
+#endif
@@ -0,0 +1,136 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosDebuggerWorldPicker.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "SlateIM.h"
+
+void FKaosDebuggerWorldPicker::Draw(float DeltaTime)
+{
+	SlateIM::BeginHorizontalStack();
+
+	SlateIM::CheckBox(TEXT("Auto Refresh"), ShouldAutoRefresh);
+	SlateIM::Spacer({6.f, 0.f});
+
+	SlateIM::Text(TEXT("Interval (s):"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(RefreshInterval, 0.1f, 10.f);
+
+	SlateIM::Spacer({12.f, 0.f});
+	SlateIM::Text(TEXT("World:"));
+	SlateIM::MinWidth(120.f);
+
+	TimeSinceLastUpdate += DeltaTime;
+	if ((ShouldAutoRefresh == ECheckBoxState::Checked && TimeSinceLastUpdate > RefreshInterval) || WorldList.IsEmpty())
+	{
+		RefreshWorldList();
+		TimeSinceLastUpdate = 0;
+	}
+
+	TArray<FString> WorldNames;
+	for (const TWeakObjectPtr<UWorld>& World : WorldList)
+	{
+		WorldNames.Add(World.IsValid() ? GetWorldLabel(World.Get()) : FString(TEXT("<Invalid>")));
+	}
+
+	SelectedWorldIndex = FMath::Clamp(SelectedWorldIndex, 0, WorldNames.Num() - 1);
+	SlateIM::ComboBox(WorldNames, SelectedWorldIndex, bForceWorldComboRefresh);
+	bForceWorldComboRefresh = false;
+
+	SlateIM::EndHorizontalStack();
+}
+
+UWorld* FKaosDebuggerWorldPicker::GetSelectedWorld()
+{
+	if (WorldList.IsEmpty())
+	{
+		RefreshWorldList();
+	}
+
+	return WorldList.IsValidIndex(SelectedWorldIndex) ? WorldList[SelectedWorldIndex].Get() : nullptr;
+}
+
+void FKaosDebuggerWorldPicker::GetDebuggableWorlds(TArray<UWorld*>& OutWorlds)
+{
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		UWorld* World = WorldContext.World();
+		if (World && IsValidChecked(World) &&
+			(World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE))
+		{
+			OutWorlds.Add(World);
+		}
+	}
+}
+
+FString FKaosDebuggerWorldPicker::GetWorldLabel(const UWorld* World)
+{
+	FString Name = World->GetName();
+	if (const FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(World))
+	{
+		if (WorldContext->WorldType == EWorldType::PIE)
+		{
+			Name += FString::Printf(TEXT(" [PIE:%d]"), WorldContext->PIEInstance);
+		}
+	}
+
+	switch (World->GetNetMode())
+	{
+	case NM_Client:
+		Name += TEXT(" (Client)");
+		break;
+	case NM_ListenServer:
+		Name += TEXT(" (ListenServer)");
+		break;
+	case NM_DedicatedServer:
+		Name += TEXT(" (DedicatedServer)");
+		break;
+	default:
+		break;
+	}
+	return Name;
+}
+
+void FKaosDebuggerWorldPicker::RefreshWorldList()
+{
+	TArray<UWorld*> Worlds;
+	GetDebuggableWorlds(Worlds);
+
+	bool bListChanged = Worlds.Num() != WorldList.Num();
+	for (int32 Index = 0; !bListChanged && Index < Worlds.Num(); ++Index)
+	{
+		bListChanged = WorldList[Index] != Worlds[Index];
+	}
+
+	if (bListChanged)
+	{
+		WorldList.Reset(Worlds.Num());
+		WorldList.Append(Worlds);
+		bForceWorldComboRefresh = true;
+
+		if (!WorldList.IsValidIndex(SelectedWorldIndex))
+		{
+			SelectedWorldIndex = WorldList.Num() > 0 ? 0 : INDEX_NONE;
+		}
+	}
+}
+#endif
@@ -20,6 +20,7 @@
 
 #include "KaosGameplayDebuggerModule.h"
 #include "KaosCheatSlateWidget.h"
+#include "KaosGameplayDebuggerDevSettings.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "Engine/LocalPlayer.h"
@@ -27,6 +28,9 @@
 #include "Implementations/KaosWorldDebugger_Actor_Details.h"
 #include "Implementations/KaosWorldDebugger_World_Details.h"
 #include "Implementations/KaosWorldDebugger_Actor_AdditionalInfo.h"
+#include "Implementations/KaosWorldDebugger_Network_Iris.h"
+#include "Implementations/KaosWorldDebugger_Network_SubObjects.h"
+#include "Implementations/KaosWorldDebugger_World_Matrix.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "MainTabs/KaosDebugger_MainTab_Networking.h"
 #include "MainTabs/KaosDebugger_MainTab_Actor.h"
@@ -65,6 +69,25 @@ static FAutoConsoleCommandWithWorld ShowUICmd(
 	})
 );
 
+static FAutoConsoleCommand StartRemoteStreamCmd(
+	TEXT("KaosDebugger.Remote.Start"),
+	TEXT("Streams debugger snapshots to a remote viewer over localhost. Usage: KaosDebugger.Remote.Start [Port]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Port = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0;
+		FKaosGameplayDebuggerModule::Get().StartRemoteStream(Port);
+	})
+);
+
+static FAutoConsoleCommand StopRemoteStreamCmd(
+	TEXT("KaosDebugger.Remote.Stop"),
+	TEXT("Stops streaming debugger snapshots to remote viewers"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FKaosGameplayDebuggerModule::Get().StopRemoteStream();
+	})
+);
+
 TArray<TSharedPtr<IKaosDebuggerBaseItem>> FKaosGameplayDebuggerModule::GetRegisteredSubCategoriesFor(FName MainTabID) const
 {
 	if (const TArray<FKaosDebuggerSubCategoryInfo>* Items = CategorySubMap.Find(MainTabID))
@@ -90,6 +113,31 @@ const TArray<TSharedPtr<IKaosDebuggerBaseItem>> FKaosGameplayDebuggerModule::Get
 	return Items;
 }
 
+void FKaosGameplayDebuggerModule::CollectSubCategorySnapshots(FName Category, const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) const
+{
+	TArray<TSharedPtr<IKaosDebuggerBaseItem>> SubTabs = GetRegisteredSubCategoriesFor(Category);
+	SubTabs.Sort([](const TSharedPtr<IKaosDebuggerBaseItem>& A, const TSharedPtr<IKaosDebuggerBaseItem>& B)
+	{
+		return A->GetTabOrder() < B->GetTabOrder();
+	});
+
+	for (const TSharedPtr<IKaosDebuggerBaseItem>& Tab : SubTabs)
+	{
+		if (!Tab.IsValid())
+		{
+			continue;
+		}
+
+		const int32 HeaderIndex = OutLines.Add(FKaosDebugLine::Header(Tab->GetTabLabel().ToString()));
+		Tab->CollectSnapshot(Context, OutLines);
+		if (OutLines.Num() == HeaderIndex + 1)
+		{
+			// Nothing to show for this tab, drop the orphan header
+			OutLines.RemoveAt(HeaderIndex);
+		}
+	}
+}
+
 void FKaosGameplayDebuggerModule::ToggleCheatUI(UWorld* World)
 {
 	if (!World) return;
@@ -116,6 +164,28 @@ void FKaosGameplayDebuggerModule::ToggleCheatUI(UWorld* World)
 	}
 }
 
+bool FKaosGameplayDebuggerModule::StartRemoteStream(int32 Port)
+{
+	const UKaosGameplayDebuggerDevSettings* Settings = GetDefault<UKaosGameplayDebuggerDevSettings>();
+	if (!RemoteServer.IsValid())
+	{
+		RemoteServer = MakeUnique<FKaosDebuggerRemoteServer>();
+	}
+	return RemoteServer->Start(Port > 0 ? Port : Settings->RemoteStreamPort, Settings->RemoteSnapshotInterval);
+}
+
+void FKaosGameplayDebuggerModule::StopRemoteStream()
+{
+	RemoteServer.Reset();
+}
+
+AActor* FKaosGameplayDebuggerModule::ConsumeActorSelectionRequest()
+{
+	AActor* Actor = RequestedActorSelection.Get();
+	RequestedActorSelection.Reset();
+	return Actor;
+}
+
 FKaosDebuggerMainCategoryHandle FKaosGameplayDebuggerModule::RegisterMainCategory(FName Category, TSharedPtr<IKaosDebuggerBaseItem> Instance, int32 IndexOrder)
 {
 	FKaosDebuggerMainCategoryHandle Handle = FKaosDebuggerMainCategoryHandle::GenerateHandle();
@@ -252,7 +322,10 @@ void FKaosGameplayDebuggerModule::StartupModule()
 
 	RegisteredSubCategories.Add(RegisterSubCategory(KaosDebuggerMainTabAreas::Actor, "Actor Details", MakeShared<FKaosWorldDebugger_Actor_Details>(), 0));
 	RegisteredSubCategories.Add(RegisterSubCategory(KaosDebuggerMainTabAreas::World, "World Details", MakeShared<FKaosWorldDebugger_World_Details>(), 999));
+	RegisteredSubCategories.Add(RegisterSubCategory(KaosDebuggerMainTabAreas::World, "World Matrix", MakeShared<FKaosWorldDebugger_World_Matrix>(), 1000));
 	RegisteredSubCategories.Add(RegisterSubCategory(KaosDebuggerMainTabAreas::Actor, "Actor Additional", MakeShared<FKaosWorldDebugger_Actor_AdditionalInfo>(), 999));
+	RegisteredSubCategories.Add(RegisterSubCategory(KaosDebuggerMainTabAreas::Network, "Replication System", MakeShared<FKaosWorldDebugger_Network_Iris>(), 1));
+	RegisteredSubCategories.Add(RegisterSubCategory(KaosDebuggerMainTabAreas::Network, "SubObject Census", MakeShared<FKaosWorldDebugger_Network_SubObjects>(), 2));
 
 	
 	BoundHandle = FWorldDelegates::OnWorldCleanup.AddLambda([this](UWorld* World, bool bA, bool bB)
@@ -294,6 +367,8 @@ void FKaosGameplayDebuggerModule::ShutdownModule()
 {
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 	FWorldDelegates::OnWorldCleanup.Remove(BoundHandle);
+	RemoteServer.Reset();
+	RemoteViewer.Disconnect();
 	for (FKaosDebuggerMainCategoryHandle& Handle : RegisteredMainCategories)
 	{
 		UnregisterMainCategory(Handle);
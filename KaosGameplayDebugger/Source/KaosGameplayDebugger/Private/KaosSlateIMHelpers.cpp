@@ -19,6 +19,7 @@
 // DEALINGS IN THE SOFTWARE.
 
 #include "KaosSlateIMHelpers.h"
+#include "KaosDebuggerHistogram.h"
 #include "Styling/SlateStyle.h"
 #include "Styling/AppStyle.h"
 #include "Styling/CoreStyle.h"
@@ -126,5 +127,62 @@ namespace KaosSlateIM
 
 		SlateIM::EndHorizontalStack();
 	}
+
+	void DebugLine(const FKaosDebugLine& Line)
+	{
+		switch (Line.Type)
+		{
+		case EKaosDebugLineType::Header:
+			SubHeaderText(Line.Label);
+			break;
+		case EKaosDebugLineType::Warning:
+			WarningText(Line.Label);
+			break;
+		case EKaosDebugLineType::Error:
+			ErrorText(Line.Label);
+			break;
+		case EKaosDebugLineType::ValuePair:
+			DrawLabledText(Line.Label, Line.Value);
+			break;
+		case EKaosDebugLineType::Separator:
+		case EKaosDebugLineType::Text:
+		default:
+			SlateIM::HAlign(HAlign_Fill);
+			SlateIM::Text(Line.Label);
+			break;
+		}
+	}
+
+	void DrawHistogram(const FStringView& Label, const FKaosLogHistogram& Histogram)
+	{
+		SlateIM::Spacer(FVector2D(0, 8));
+		SubHeaderText(Label);
+		if (Histogram.GetCount() == 0)
+		{
+			SlateIM::Text(TEXT("No samples."));
+			return;
+		}
+
+		DrawLabledText(TEXT("Samples"), FString::FromInt(Histogram.GetCount()));
+		DrawLabledText(TEXT("Min / Mean / Max"), FString::Printf(TEXT("%.2f / %.2f / %.2f ms"), Histogram.GetMin() * 1000.0, Histogram.GetMean() * 1000.0, Histogram.GetMax() * 1000.0));
+		DrawLabledText(TEXT("p50 / p95 / p99"), FString::Printf(TEXT("%.2f / %.2f / %.2f ms"), Histogram.GetPercentile(0.5) * 1000.0, Histogram.GetPercentile(0.95) * 1000.0, Histogram.GetPercentile(0.99) * 1000.0));
+
+		// Only the populated range is drawn, empty buckets at either end carry no information
+		int32 FirstBucket = 0;
+		int32 LastBucket = FKaosLogHistogram::NumBuckets - 1;
+		while (Histogram.GetBucketCount(FirstBucket) == 0) { ++FirstBucket; }
+		while (Histogram.GetBucketCount(LastBucket) == 0) { --LastBucket; }
+
+		const int32 LargestBucket = Histogram.GetLargestBucketCount();
+		for (int32 BucketIndex = FirstBucket; BucketIndex <= LastBucket; ++BucketIndex)
+		{
+			const int32 BucketCount = Histogram.GetBucketCount(BucketIndex);
+			const FString Range = BucketIndex == FKaosLogHistogram::NumBuckets - 1
+				? FString::Printf(TEXT(">= %.2f ms"), Histogram.GetBucketLowerBound(BucketIndex) * 1000.0)
+				: FString::Printf(TEXT("< %.2f ms"), Histogram.GetBucketUpperBound(BucketIndex) * 1000.0);
+			const FString Bar = FString::ChrN(FMath::CeilToInt32(40.f * BucketCount / LargestBucket), TEXT('|'));
+			DrawLabledText(Range, FString::Printf(TEXT("%s %d"), *Bar, BucketCount));
+		}
+	}
 #endif
 }
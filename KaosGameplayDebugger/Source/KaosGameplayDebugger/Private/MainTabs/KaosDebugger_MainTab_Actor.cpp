@@ -31,6 +31,7 @@
 #include "GameFramework/PlayerController.h"
 #include "KaosGameplayDebuggerDevSettings.h"
 #include "KaosGameplayDebuggerModule.h"
+#include "KaosDebuggerWorldPicker.h"
 #include "ProfilingDebugging/ScopedTimers.h"
 #include "Engine/HitResult.h"
 
@@ -64,43 +65,7 @@ void FKaosDebugger_MainTab_Actor::HandleActorSelection()
 				{
 					if (AActor* HitActor = Hit.GetActor())
 					{
-						if (HitActor->IsChildActor() && EnablePickParentActorSelection == ECheckBoxState::Checked)
-						{
-							SelectedActor = HitActor->GetParentActor();
-						}
-						else
-						{
-							SelectedActor = HitActor;
-						}
-						
-						for (int32 i = 0; i < WorldList.Num(); ++i)
-						{
-							if (WorldList[i].IsValid() && WorldList[i].Get() == SelectedActor->GetWorld())
-							{
-								bForceWorldComboRefresh = true;
-								bForceActorComboRefresh = true;
-								if (SelectedWorldIndex != i)
-								{
-									RefreshWorldList();
-									SelectedWorldIndex = i;
-									RefreshActorList();
-								}
-								break;
-							}
-						}
-
-						for (int32 i = 0; i < ActorList.Num(); ++i)
-						{
-							if (ActorList[i].IsValid() && ActorList[i].Get() == SelectedActor)
-							{
-								SelectedActorIndex = i;
-								break;
-							}
-						}
-
-						UE_LOG(LogTemp, Log, TEXT("Selected actor: %s (World: %s)"),
-							*SelectedActor->GetName(), *SelectedActor->GetWorld()->GetName());
-
+						SelectActor(HitActor->IsChildActor() && EnablePickParentActorSelection == ECheckBoxState::Checked ? HitActor->GetParentActor() : HitActor);
 						return;
 					}
 				}
@@ -109,8 +74,52 @@ void FKaosDebugger_MainTab_Actor::HandleActorSelection()
 	}
 }
 
+void FKaosDebugger_MainTab_Actor::SelectActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	SelectedActor = Actor;
+
+	// Refreshing can reorder the list, so the actor's world is looked up in the refreshed one
+	UWorld* ActorWorld = SelectedActor->GetWorld();
+	const UWorld* PreviousWorld = WorldList.IsValidIndex(SelectedWorldIndex) ? WorldList[SelectedWorldIndex].Get() : nullptr;
+	RefreshWorldList();
+	const int32 WorldIndex = WorldList.IndexOfByKey(ActorWorld);
+	if (WorldIndex != INDEX_NONE)
+	{
+		bForceWorldComboRefresh = true;
+		bForceActorComboRefresh = true;
+		SelectedWorldIndex = WorldIndex;
+		if (PreviousWorld != ActorWorld)
+		{
+			RefreshActorList();
+		}
+	}
+
+	for (int32 i = 0; i < ActorList.Num(); ++i)
+	{
+		if (ActorList[i].IsValid() && ActorList[i].Get() == SelectedActor)
+		{
+			SelectedActorIndex = i;
+			break;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Selected actor: %s (World: %s)"),
+		*SelectedActor->GetName(), *SelectedActor->GetWorld()->GetName());
+}
+
 void FKaosDebugger_MainTab_Actor::DrawDetails(const FKaosDebuggerContext& Context)
 {
+	// Other tabs can ask for an actor to be inspected, e.g. by clicking a row in a world wide list
+	if (AActor* RequestedActor = FKaosGameplayDebuggerModule::Get().ConsumeActorSelectionRequest())
+	{
+		SelectActor(RequestedActor);
+	}
+
 	SlateIM::BeginVerticalStack();
 	SlateIM::BeginHorizontalStack();
 
@@ -151,42 +160,9 @@ void FKaosDebugger_MainTab_Actor::DrawDetails(const FKaosDebuggerContext& Contex
 	}
 
 	TArray<FString> WorldNames;
-	for (const auto& World : WorldList)
+	for (const TWeakObjectPtr<UWorld>& World : WorldList)
 	{
-		if (!World.IsValid())
-		{
-			WorldNames.Add(TEXT("<Invalid>"));
-			continue;
-		}
-
-		UWorld* W = World.Get();
-		FString Name = W->GetName();
-
-		const FWorldContext* FoundContext = GEngine->GetWorldContextFromWorld(W);
-		if (FoundContext)
-		{
-			if (FoundContext->WorldType == EWorldType::PIE)
-			{
-				Name += FString::Printf(TEXT(" [PIE:%d]"), FoundContext->PIEInstance);
-			}
-
-			switch (W->GetNetMode())
-			{
-			case NM_Client:
-				Name += TEXT(" (Client)");
-				break;
-			case NM_ListenServer:
-				Name += TEXT(" (ListenServer)");
-				break;
-			case NM_DedicatedServer:
-				Name += TEXT(" (DedicatedServer)");
-				break;
-			default:
-				break;
-			}
-		}
-
-		WorldNames.Add(Name);
+		WorldNames.Add(World.IsValid() ? FKaosDebuggerWorldPicker::GetWorldLabel(World.Get()) : FString(TEXT("<Invalid>")));
 	}
 	
 		SelectedWorldIndex = FMath::Clamp(SelectedWorldIndex, 0, WorldNames.Num() - 1);
@@ -280,48 +256,28 @@ void FKaosDebugger_MainTab_Actor::DrawDetails(const FKaosDebuggerContext& Contex
 	SlateIM::EndVerticalStack();
 }
 
-#if WITH_EDITOR
-void FKaosDebugger_MainTab_Actor::HandleActorSelectionChanged(UObject* Object)
+void FKaosDebugger_MainTab_Actor::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
 {
-	if (AActor* Actor = Cast<AActor>(Object))
+	if (!SelectedActor.IsValid())
 	{
-		if (Actor->IsChildActor() && EnablePickParentActorSelection == ECheckBoxState::Checked)
-		{
-			SelectedActor = Actor->GetParentActor();
-		}
-		else
-		{
-			SelectedActor = Actor;
-		}
-						
-		for (int32 i = 0; i < WorldList.Num(); ++i)
-		{
-			if (WorldList[i].IsValid() && WorldList[i].Get() == SelectedActor->GetWorld())
-			{
-				bForceWorldComboRefresh = true;
-				bForceActorComboRefresh = true;
-				if (SelectedWorldIndex != i)
-				{
-					RefreshWorldList();
-					SelectedWorldIndex = i;
-					RefreshActorList();
-				}
-				break;
-			}
-		}
+		OutLines.Add(FKaosDebugLine::Warning(TEXT("No Actor selected.")));
+		return;
+	}
 
-		for (int32 i = 0; i < ActorList.Num(); ++i)
-		{
-			if (ActorList[i].IsValid() && ActorList[i].Get() == SelectedActor)
-			{
-				SelectedActorIndex = i;
-				break;
-			}
-		}
+	FKaosDebuggerContext TabContext;
+	TabContext.ContextObject = SelectedActor;
+	TabContext.ContextWorld = SelectedActor->GetWorld();
+	TabContext.DeltaTime = Context.DeltaTime;
 
-		UE_LOG(LogTemp, Log, TEXT("Selected actor: %s (World: %s)"),
-			*SelectedActor->GetName(), *SelectedActor->GetWorld()->GetName());
+	FKaosGameplayDebuggerModule::Get().CollectSubCategorySnapshots(KaosDebuggerMainTabAreas::Actor, TabContext, OutLines);
+}
 
+#if WITH_EDITOR
+void FKaosDebugger_MainTab_Actor::HandleActorSelectionChanged(UObject* Object)
+{
+	if (AActor* Actor = Cast<AActor>(Object))
+	{
+		SelectActor(Actor->IsChildActor() && EnablePickParentActorSelection == ECheckBoxState::Checked ? Actor->GetParentActor() : Actor);
 		return;
 	}
 }
@@ -330,19 +286,9 @@ void FKaosDebugger_MainTab_Actor::HandleActorSelectionChanged(UObject* Object)
 
 void FKaosDebugger_MainTab_Actor::RefreshWorldList()
 {
-	TArray<TWeakObjectPtr<UWorld>> NewWorldList;
-
-	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
-	{
-		if (UWorld* World = WorldContext.World())
-		{
-			if (IsValidChecked(World) &&
-				(World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE))
-			{
-				NewWorldList.Add(World);
-			}
-		}
-	}
+	TArray<UWorld*> Worlds;
+	FKaosDebuggerWorldPicker::GetDebuggableWorlds(Worlds);
+	TArray<TWeakObjectPtr<UWorld>> NewWorldList(Worlds);
 
 	bool bListChanged = (NewWorldList.Num() != WorldList.Num());
 	if (!bListChanged)
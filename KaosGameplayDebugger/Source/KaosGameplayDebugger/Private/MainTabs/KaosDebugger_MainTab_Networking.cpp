@@ -20,8 +20,70 @@
 
 #include "MainTabs/KaosDebugger_MainTab_Networking.h"
 #if WITH_KAOS_GAMEPLAYDEBUGGER
+
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Styling/SlateStyle.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+#include "KaosGameplayDebuggerModule.h"
+
 void FKaosDebugger_MainTab_Networking::DrawDetails(const FKaosDebuggerContext& Context)
 {
+	SlateIM::BeginVerticalStack();
+	WorldPicker.Draw(Context.DeltaTime);
+	SelectedWorld = WorldPicker.GetSelectedWorld();
+
+	FKaosDebuggerContext TabContext;
+	TabContext.ContextWorld = SelectedWorld;
+	TabContext.DeltaTime = Context.DeltaTime;
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTabGroup(TEXT("NetworkDebugTabs"));
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTabStack();
+
+	FKaosGameplayDebuggerModule& Module = FKaosGameplayDebuggerModule::Get();
+	TArray<TSharedPtr<IKaosDebuggerBaseItem>> SubTabs =
+		Module.GetRegisteredSubCategoriesFor(KaosDebuggerMainTabAreas::Network);
+
+	SubTabs.Sort([](const TSharedPtr<IKaosDebuggerBaseItem>& A, const TSharedPtr<IKaosDebuggerBaseItem>& B)
+	{
+		return A->GetTabOrder() < B->GetTabOrder();
+	});
+
+	for (const TSharedPtr<IKaosDebuggerBaseItem>& Tab : SubTabs)
+	{
+		if (!Tab.IsValid()) continue;
+		if (SlateIM::BeginTab(FName(*Tab->GetTabLabel().ToString()), Tab->GetTabIcon(), Tab->GetTabLabel()))
+		{
+			SlateIM::Fill();
+			SlateIM::HAlign(HAlign_Fill);
+			SlateIM::VAlign(VAlign_Fill);
+			Tab->DrawDetails(TabContext);
+		}
+		SlateIM::EndTab();
+	}
+
+	SlateIM::EndTabStack();
+	SlateIM::EndTabGroup();
+
+	SlateIM::EndVerticalStack();
+}
+
+void FKaosDebugger_MainTab_Networking::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	SelectedWorld = WorldPicker.GetSelectedWorld();
+
+	FKaosDebuggerContext TabContext;
+	TabContext.ContextWorld = SelectedWorld;
+	TabContext.DeltaTime = Context.DeltaTime;
+
+	FKaosGameplayDebuggerModule::Get().CollectSubCategorySnapshots(KaosDebuggerMainTabAreas::Network, TabContext, OutLines);
 }
 
 FSlateIcon FKaosDebugger_MainTab_Networking::GetTabIcon() const
@@ -22,105 +22,19 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 
 #include "Engine/Engine.h"
-#include "Misc/App.h"
 #include "Styling/SlateStyle.h"
 #include "Styling/AppStyle.h"
 #include "Styling/CoreStyle.h"
 #include "GameFramework/PlayerController.h"
 #include "KaosGameplayDebuggerModule.h"
-#include "ProfilingDebugging/ScopedTimers.h"
 #include "Engine/HitResult.h"
 
 void FKaosDebugger_MainTab_World::DrawDetails(const FKaosDebuggerContext& Context)
 {
 	SlateIM::BeginVerticalStack();
-	SlateIM::BeginHorizontalStack();
+	WorldPicker.Draw(Context.DeltaTime);
+	SelectedWorld = WorldPicker.GetSelectedWorld();
 
-	SlateIM::CheckBox(TEXT("Auto Refresh"), ShouldAutoRefresh);
-	SlateIM::Spacer({6.f, 0.f});
-
-	SlateIM::Text(TEXT("Interval (s):"));
-	SlateIM::MinWidth(60.f);
-	SlateIM::SpinBox(RefreshInterval, 0.1f, 10.f);
-
-	SlateIM::Spacer({12.f, 0.f});
-	SlateIM::Text(TEXT("World:"));
-	SlateIM::MinWidth(120.f);
-
-	double LastTime = CurrentTime;
-	CurrentTime = 0;
-	FScopedDurationTimer Timer(CurrentTime);
-	TimeSinceLastUpdate += FApp::GetDeltaTime();
-
-	if (ShouldAutoRefresh == ECheckBoxState::Checked && TimeSinceLastUpdate > RefreshInterval)
-	{
-		bRefreshAll = true;
-		TimeSinceLastUpdate = 0;
-	}
-	else if (ShouldAutoRefresh == ECheckBoxState::Unchecked)
-	{
-		bRefreshAll = false;
-	}
-
-	if (bRefreshAll || WorldList.IsEmpty())
-	{
-		RefreshWorldList();
-		bRefreshAll = false;
-	}
-
-	TArray<FString> WorldNames;
-	for (const auto& World : WorldList)
-	{
-		if (!World.IsValid())
-		{
-			WorldNames.Add(TEXT("<Invalid>"));
-			continue;
-		}
-
-		UWorld* W = World.Get();
-		FString Name = W->GetName();
-
-		// Find the corresponding context
-		const FWorldContext* FoundContext = GEngine->GetWorldContextFromWorld(W);
-		if (FoundContext)
-		{
-			// PIE Instance?
-			if (FoundContext->WorldType == EWorldType::PIE)
-			{
-				Name += FString::Printf(TEXT(" [PIE:%d]"), FoundContext->PIEInstance);
-			}
-
-			// Net mode
-			switch (W->GetNetMode())
-			{
-			case NM_Client:
-				Name += TEXT(" (Client)");
-				break;
-			case NM_ListenServer:
-				Name += TEXT(" (ListenServer)");
-				break;
-			case NM_DedicatedServer:
-				Name += TEXT(" (DedicatedServer)");
-				break;
-			default:
-				break;
-			}
-		}
-
-		WorldNames.Add(Name);
-	}
-
-
-	SelectedWorldIndex = FMath::Clamp(SelectedWorldIndex, 0, WorldNames.Num() - 1);
-	if (SlateIM::ComboBox(WorldNames, SelectedWorldIndex, bForceWorldComboRefresh))
-	{
-	}
-	SlateIM::EndHorizontalStack();
-
-	SelectedWorld = (WorldList.IsValidIndex(SelectedWorldIndex))
-	? WorldList[SelectedWorldIndex].Get()
-	: nullptr;
-	
 	FKaosDebuggerContext TabContext;
 	TabContext.ContextWorld = SelectedWorld;
 	TabContext.DeltaTime = Context.DeltaTime;
@@ -162,51 +76,22 @@ void FKaosDebugger_MainTab_World::DrawDetails(const FKaosDebuggerContext& Contex
 	SlateIM::EndVerticalStack();
 }
 
-FSlateIcon FKaosDebugger_MainTab_World::GetTabIcon() const
+void FKaosDebugger_MainTab_World::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
 {
-	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "AnimViewport.WorldSpaceEditing");
+	// The window may never have been opened when only streaming, so make sure we have a world to report on
+	SelectedWorld = WorldPicker.GetSelectedWorld();
 
-	return MyIcon;
+	FKaosDebuggerContext TabContext;
+	TabContext.ContextWorld = SelectedWorld;
+	TabContext.DeltaTime = Context.DeltaTime;
+
+	FKaosGameplayDebuggerModule::Get().CollectSubCategorySnapshots(KaosDebuggerMainTabAreas::World, TabContext, OutLines);
 }
 
-void FKaosDebugger_MainTab_World::RefreshWorldList()
+FSlateIcon FKaosDebugger_MainTab_World::GetTabIcon() const
 {
-	TArray<TWeakObjectPtr<UWorld>> NewWorldList;
-
-	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
-	{
-		if (UWorld* World = WorldContext.World())
-		{
-			if (IsValidChecked(World) &&
-				(World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE))
-			{
-				NewWorldList.Add(World);
-			}
-		}
-	}
-
-	bool bListChanged = (NewWorldList.Num() != WorldList.Num());
-	if (!bListChanged)
-	{
-		for (int32 i = 0; i < NewWorldList.Num(); ++i)
-		{
-			if (NewWorldList[i] != WorldList[i])
-			{
-				bListChanged = true;
-				break;
-			}
-		}
-	}
-
-	if (bListChanged)
-	{
-		WorldList = MoveTemp(NewWorldList);
-		bForceWorldComboRefresh = true;
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "AnimViewport.WorldSpaceEditing");
 
-		if (!WorldList.IsValidIndex(SelectedWorldIndex))
-		{
-			SelectedWorldIndex = WorldList.Num() > 0 ? 0 : INDEX_NONE;
-		}
-	}
+	return MyIcon;
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Remote/KaosDebuggerRemoteProtocol.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace KaosDebuggerRemote
+{
+	// Smallest encodings on the wire: an empty label and a line count, or a type byte and two empty strings
+	static constexpr int64 MinTabBytes = sizeof(int32) + sizeof(int32);
+	static constexpr int64 MinLineBytes = sizeof(uint8) + sizeof(int32) + sizeof(int32);
+
+	/** Counts come straight off the wire, don't let one reserve more than the rest of the payload could hold */
+	static bool IsCountPlausible(FArchive& Ar, int32 Count, int64 MinItemBytes)
+	{
+		return Count >= 0 && Count <= (Ar.TotalSize() - Ar.Tell()) / MinItemBytes;
+	}
+
+	/** Same encoding as FString's operator<<, but a length the payload can't hold fails the read before allocating */
+	static void SerializeString(FArchive& Ar, FString& Value)
+	{
+		if (Ar.IsLoading())
+		{
+			const int64 LengthOffset = Ar.Tell();
+			int32 SaveNum = 0;
+			Ar << SaveNum;
+
+			// Negative lengths mark UTF-16 strings
+			const int64 StringBytes = SaveNum < 0 ? -static_cast<int64>(SaveNum) * sizeof(UTF16CHAR) : static_cast<int64>(SaveNum);
+			if (Ar.IsError() || StringBytes > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return;
+			}
+			Ar.Seek(LengthOffset);
+		}
+		Ar << Value;
+	}
+
+	static void SerializeLine(FArchive& Ar, EKaosDebugLineType& Type, FString& Label, FString& Value)
+	{
+		uint8 TypeByte = static_cast<uint8>(Type);
+		Ar << TypeByte;
+		SerializeString(Ar, Label);
+		SerializeString(Ar, Value);
+		Type = static_cast<EKaosDebugLineType>(TypeByte);
+	}
+
+	void WriteFrame(const FKaosRemoteSnapshot& Snapshot, TArray<uint8>& OutFrame)
+	{
+		OutFrame.Reset();
+		FMemoryWriter Writer(OutFrame);
+		Writer.SetByteSwapping(false);
+
+		uint32 Magic = FrameMagic;
+		uint16 Version = ProtocolVersion;
+		uint16 Reserved = 0;
+		uint32 PayloadSize = 0;
+		Writer << Magic << Version << Reserved << PayloadSize;
+
+		uint64 FrameNumber = Snapshot.FrameNumber;
+		double CaptureTime = Snapshot.CaptureTime;
+		int32 TabCount = Snapshot.Tabs.Num();
+		Writer << FrameNumber << CaptureTime << TabCount;
+
+		for (const FKaosRemoteTabSnapshot& Tab : Snapshot.Tabs)
+		{
+			FString TabLabel = Tab.TabLabel;
+			int32 LineCount = Tab.Lines.Num();
+			SerializeString(Writer, TabLabel);
+			Writer << LineCount;
+			for (const FKaosDebugLine& Line : Tab.Lines)
+			{
+				EKaosDebugLineType Type = Line.Type;
+				FString Label = Line.Label;
+				FString Value = Line.Value;
+				SerializeLine(Writer, Type, Label, Value);
+			}
+		}
+
+		// Patch the payload size now that we know it
+		PayloadSize = OutFrame.Num() - FrameHeaderSize;
+		Writer.Seek(FrameHeaderSize - sizeof(uint32));
+		Writer << PayloadSize;
+	}
+
+	bool ReadFrameHeader(const uint8* Header, uint32& OutPayloadSize)
+	{
+		TArray<uint8> HeaderBytes(Header, FrameHeaderSize);
+		FMemoryReader Reader(HeaderBytes);
+		Reader.SetByteSwapping(false);
+
+		uint32 Magic = 0;
+		uint16 Version = 0;
+		uint16 Reserved = 0;
+		Reader << Magic << Version << Reserved << OutPayloadSize;
+
+		return Magic == FrameMagic && Version == ProtocolVersion && OutPayloadSize <= MaxPayloadSize;
+	}
+
+	bool ReadPayload(const TArray<uint8>& Payload, FKaosRemoteSnapshot& OutSnapshot)
+	{
+		FMemoryReader Reader(Payload);
+		Reader.SetByteSwapping(false);
+
+		int32 TabCount = 0;
+		Reader << OutSnapshot.FrameNumber << OutSnapshot.CaptureTime << TabCount;
+		if (Reader.IsError() || !IsCountPlausible(Reader, TabCount, MinTabBytes))
+		{
+			return false;
+		}
+
+		OutSnapshot.Tabs.Reset(TabCount);
+		for (int32 TabIdx = 0; TabIdx < TabCount && !Reader.IsError(); ++TabIdx)
+		{
+			FKaosRemoteTabSnapshot& Tab = OutSnapshot.Tabs.AddDefaulted_GetRef();
+			int32 LineCount = 0;
+			SerializeString(Reader, Tab.TabLabel);
+			Reader << LineCount;
+			if (Reader.IsError() || !IsCountPlausible(Reader, LineCount, MinLineBytes))
+			{
+				return false;
+			}
+
+			Tab.Lines.Reserve(LineCount);
+			for (int32 LineIdx = 0; LineIdx < LineCount && !Reader.IsError(); ++LineIdx)
+			{
+				EKaosDebugLineType Type = EKaosDebugLineType::Text;
+				FString Label;
+				FString Value;
+				SerializeLine(Reader, Type, Label, Value);
+				Tab.Lines.Emplace(Type, MoveTemp(Label), MoveTemp(Value));
+			}
+		}
+		return !Reader.IsError();
+	}
+}
+#endif
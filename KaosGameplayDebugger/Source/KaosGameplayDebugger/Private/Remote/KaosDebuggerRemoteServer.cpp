@@ -0,0 +1,254 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Remote/KaosDebuggerRemoteServer.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Common/TcpListener.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "KaosGameplayDebuggerModule.h"
+#include "Misc/App.h"
+#include "Remote/KaosDebuggerRemoteProtocol.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+FKaosDebuggerRemoteServer::~FKaosDebuggerRemoteServer()
+{
+	Stop();
+}
+
+bool FKaosDebuggerRemoteServer::Start(int32 Port, float InSnapshotInterval)
+{
+	Stop();
+
+	// Loopback only, the stream is meant for a viewer on the same machine
+	const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), Port);
+	ListenSocket = FTcpSocketBuilder(TEXT("KaosDebuggerRemoteServer"))
+		.AsReusable()
+		.BoundToEndpoint(Endpoint)
+		.Listening(8)
+		.Build();
+
+	if (!ListenSocket)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("KaosDebugger.Remote: Failed to listen on %s"), *Endpoint.ToString());
+		return false;
+	}
+
+	Listener = MakeUnique<FTcpListener>(*ListenSocket, FTimespan::FromMilliseconds(100));
+	Listener->OnConnectionAccepted().BindRaw(this, &FKaosDebuggerRemoteServer::HandleConnectionAccepted);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FKaosDebuggerRemoteServer::Tick), FMath::Max(InSnapshotInterval, 0.f));
+
+	UE_LOG(LogTemp, Log, TEXT("KaosDebugger.Remote: Streaming snapshots on %s (protocol v%d)"), *Endpoint.ToString(), KaosDebuggerRemote::ProtocolVersion);
+	return true;
+}
+
+void FKaosDebuggerRemoteServer::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Stops the accept thread before we tear down the clients it could add to
+	Listener.Reset();
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (ListenSocket)
+	{
+		ListenSocket->Close();
+		SocketSubsystem->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+	}
+
+	// Shut the sockets down first so a send in flight fails straight away instead of keeping us waiting
+	{
+		FScopeLock Lock(&ClientsLock);
+		for (const TSharedPtr<FKaosRemoteClient>& Client : Clients)
+		{
+			Client->Socket->Shutdown(ESocketShutdownMode::ReadWrite);
+		}
+	}
+
+	if (SendTask.IsValid())
+	{
+		SendTask.Wait();
+		SendTask = {};
+	}
+
+	FScopeLock Lock(&ClientsLock);
+	for (const TSharedPtr<FKaosRemoteClient>& Client : Clients)
+	{
+		Client->Socket->Close();
+		SocketSubsystem->DestroySocket(Client->Socket);
+	}
+	Clients.Reset();
+	NumClients = 0;
+}
+
+bool FKaosDebuggerRemoteServer::HandleConnectionAccepted(FSocket* Socket, const FIPv4Endpoint& Endpoint)
+{
+	Socket->SetNonBlocking(true);
+	Socket->SetNoDelay(true);
+
+	TSharedPtr<FKaosRemoteClient> Client = MakeShared<FKaosRemoteClient>();
+	Client->Socket = Socket;
+
+	FScopeLock Lock(&ClientsLock);
+	Clients.Add(MoveTemp(Client));
+	NumClients = Clients.Num();
+	UE_LOG(LogTemp, Log, TEXT("KaosDebugger.Remote: Viewer connected from %s"), *Endpoint.ToString());
+	return true;
+}
+
+bool FKaosDebuggerRemoteServer::Tick(float DeltaTime)
+{
+	SCOPED_NAMED_EVENT_TEXT("FKaosDebuggerRemoteServer::Tick", FColorList::Goldenrod);
+
+	// Latest wins, if the viewer can't keep up we skip frames rather than queue them
+	if (SendTask.IsValid() && !SendTask.IsCompleted())
+	{
+		return true;
+	}
+
+	if (GetNumClients() == 0)
+	{
+		return true;
+	}
+
+	FKaosRemoteSnapshot Snapshot;
+	Snapshot.FrameNumber = FrameNumber++;
+	Snapshot.CaptureTime = FApp::GetCurrentTime();
+	CollectSnapshot(Snapshot);
+	KaosDebuggerRemote::WriteFrame(Snapshot, PendingFrame);
+
+	SendTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]()
+	{
+		SendFrame(PendingFrame);
+	});
+	return true;
+}
+
+void FKaosDebuggerRemoteServer::CollectSnapshot(FKaosRemoteSnapshot& OutSnapshot) const
+{
+	FKaosGameplayDebuggerModule& Module = FKaosGameplayDebuggerModule::Get();
+	TArray<TSharedPtr<IKaosDebuggerBaseItem>> MainTabs = Module.GetRegisteredMainTabs();
+
+	MainTabs.Sort([](const TSharedPtr<IKaosDebuggerBaseItem>& A, const TSharedPtr<IKaosDebuggerBaseItem>& B)
+	{
+		return A->GetTabOrder() < B->GetTabOrder();
+	});
+
+	FKaosDebuggerContext Context;
+	Context.DeltaTime = FApp::GetDeltaTime();
+	for (const TSharedPtr<IKaosDebuggerBaseItem>& Tab : MainTabs)
+	{
+		if (!Tab.IsValid())
+		{
+			continue;
+		}
+
+		FKaosRemoteTabSnapshot TabSnapshot;
+		Tab->CollectSnapshot(Context, TabSnapshot.Lines);
+		if (!TabSnapshot.Lines.IsEmpty())
+		{
+			TabSnapshot.TabLabel = Tab->GetTabLabel().ToString();
+			OutSnapshot.Tabs.Add(MoveTemp(TabSnapshot));
+		}
+	}
+}
+
+void FKaosDebuggerRemoteServer::SendFrame(const TArray<uint8>& Frame)
+{
+	TArray<TSharedPtr<FKaosRemoteClient>> ClientsToSend;
+	{
+		FScopeLock Lock(&ClientsLock);
+		ClientsToSend = Clients;
+	}
+
+	TArray<TSharedPtr<FKaosRemoteClient>> ClientsToDrop;
+	for (const TSharedPtr<FKaosRemoteClient>& Client : ClientsToSend)
+	{
+		if (!SendToClient(*Client, Frame))
+		{
+			ClientsToDrop.Add(Client);
+		}
+	}
+
+	if (ClientsToDrop.IsEmpty())
+	{
+		return;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	FScopeLock Lock(&ClientsLock);
+	for (const TSharedPtr<FKaosRemoteClient>& Client : ClientsToDrop)
+	{
+		UE_LOG(LogTemp, Log, TEXT("KaosDebugger.Remote: Viewer disconnected (%d frames behind)"), Client->SkippedFrames);
+		Clients.Remove(Client);
+		Client->Socket->Close();
+		SocketSubsystem->DestroySocket(Client->Socket);
+	}
+	NumClients = Clients.Num();
+}
+
+bool FKaosDebuggerRemoteServer::SendToClient(FKaosRemoteClient& Client, const TArray<uint8>& Frame)
+{
+	// Finish the previous frame first, a frame is never cut short or the viewer would lose sync with the stream
+	if (Client.UnsentOffset < Client.Unsent.Num())
+	{
+		if (!FlushClient(Client))
+		{
+			return false;
+		}
+
+		if (Client.UnsentOffset < Client.Unsent.Num())
+		{
+			return ++Client.SkippedFrames <= MaxSkippedFrames;
+		}
+	}
+
+	Client.Unsent = Frame;
+	Client.UnsentOffset = 0;
+	Client.SkippedFrames = 0;
+	return FlushClient(Client);
+}
+
+bool FKaosDebuggerRemoteServer::FlushClient(FKaosRemoteClient& Client)
+{
+	while (Client.UnsentOffset < Client.Unsent.Num())
+	{
+		int32 BytesSent = 0;
+		if (!Client.Socket->Send(Client.Unsent.GetData() + Client.UnsentOffset, Client.Unsent.Num() - Client.UnsentOffset, BytesSent))
+		{
+			// A full send buffer just means the viewer is behind, anything else means it is gone
+			return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+		}
+
+		if (BytesSent <= 0)
+		{
+			return true;
+		}
+		Client.UnsentOffset += BytesSent;
+	}
+	return true;
+}
+#endif
@@ -0,0 +1,228 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Remote/KaosDebuggerRemoteViewer.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Common/TcpSocketBuilder.h"
+#include "HAL/RunnableThread.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "KaosSlateIMHelpers.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+FKaosDebuggerRemoteViewer::~FKaosDebuggerRemoteViewer()
+{
+	Disconnect();
+}
+
+bool FKaosDebuggerRemoteViewer::Connect(const FString& Address)
+{
+	Disconnect();
+
+	FIPv4Endpoint Endpoint;
+	if (!FIPv4Endpoint::Parse(Address, Endpoint))
+	{
+		StatusText = FString::Printf(TEXT("Invalid address '%s', expected ip:port"), *Address);
+		return false;
+	}
+
+	Socket = FTcpSocketBuilder(TEXT("KaosDebuggerRemoteViewer")).AsBlocking().Build();
+	if (!Socket || !Socket->Connect(*Endpoint.ToInternetAddr()))
+	{
+		StatusText = FString::Printf(TEXT("Failed to connect to %s"), *Endpoint.ToString());
+		Disconnect();
+		return false;
+	}
+
+	bStopRequested = false;
+	bReaderFinished = false;
+	MalformedFrames = 0;
+	SkippedFrames = 0;
+	LastReceivedFrameNumber.Reset();
+	Thread = FRunnableThread::Create(this, TEXT("KaosDebuggerRemoteViewer"), 0, TPri_BelowNormal);
+	StatusText = FString::Printf(TEXT("Connected to %s"), *Endpoint.ToString());
+	return true;
+}
+
+void FKaosDebuggerRemoteViewer::Disconnect()
+{
+	bStopRequested = true;
+	if (Socket)
+	{
+		// Unblocks any pending receive on the reader thread
+		Socket->Shutdown(ESocketShutdownMode::ReadWrite);
+		Socket->Close();
+	}
+
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (Socket)
+	{
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+}
+
+bool FKaosDebuggerRemoteViewer::ReceiveExactly(uint8* Data, int32 Size)
+{
+	int32 TotalRead = 0;
+	while (TotalRead < Size && !bStopRequested)
+	{
+		int32 BytesRead = 0;
+		if (!Socket->Recv(Data + TotalRead, Size - TotalRead, BytesRead, ESocketReceiveFlags::WaitAll) || BytesRead <= 0)
+		{
+			return false;
+		}
+		TotalRead += BytesRead;
+	}
+	return TotalRead == Size;
+}
+
+uint32 FKaosDebuggerRemoteViewer::Run()
+{
+	uint8 Header[KaosDebuggerRemote::FrameHeaderSize];
+	TArray<uint8> Payload;
+
+	while (!bStopRequested)
+	{
+		uint32 PayloadSize = 0;
+		if (!ReceiveExactly(Header, KaosDebuggerRemote::FrameHeaderSize))
+		{
+			break;
+		}
+
+		if (!KaosDebuggerRemote::ReadFrameHeader(Header, PayloadSize))
+		{
+			// We can't resync a stream with a foreign header, bail out
+			UE_LOG(LogTemp, Warning, TEXT("KaosDebugger.Remote: Received a frame with an unsupported header, expected protocol v%d"), KaosDebuggerRemote::ProtocolVersion);
+			break;
+		}
+
+		Payload.SetNumUninitialized(PayloadSize);
+		if (!ReceiveExactly(Payload.GetData(), PayloadSize))
+		{
+			break;
+		}
+
+		FKaosRemoteSnapshot Snapshot;
+		if (!KaosDebuggerRemote::ReadPayload(Payload, Snapshot))
+		{
+			++MalformedFrames;
+			continue;
+		}
+
+		// Frame numbers are consecutive on the server, a gap means it skipped frames while we were behind
+		if (LastReceivedFrameNumber.IsSet() && Snapshot.FrameNumber > LastReceivedFrameNumber.GetValue() + 1)
+		{
+			SkippedFrames += static_cast<int32>(Snapshot.FrameNumber - LastReceivedFrameNumber.GetValue() - 1);
+		}
+		LastReceivedFrameNumber = Snapshot.FrameNumber;
+
+		FScopeLock Lock(&SnapshotLock);
+		if (ReceivedSnapshot.IsSet())
+		{
+			++SkippedFrames;
+		}
+		ReceivedSnapshot = MoveTemp(Snapshot);
+	}
+
+	bReaderFinished = true;
+	return 0;
+}
+
+void FKaosDebuggerRemoteViewer::DrawWindow(float DeltaTime)
+{
+	if (Thread && bReaderFinished && !bStopRequested)
+	{
+		// The server closed the connection or sent something we can't read
+		Disconnect();
+		StatusText = TEXT("Connection lost");
+	}
+
+	SlateIM::BeginVerticalStack();
+	SlateIM::BeginHorizontalStack();
+	SlateIM::Text(TEXT("Address:"));
+	SlateIM::MinWidth(160.f);
+	SlateIM::EditableText(AddressText, TEXT("127.0.0.1:41950"));
+	if (SlateIM::Button(IsConnected() ? TEXT("Disconnect") : TEXT("Connect")))
+	{
+		if (IsConnected())
+		{
+			Disconnect();
+			StatusText = TEXT("Disconnected");
+		}
+		else
+		{
+			Connect(AddressText);
+		}
+	}
+	SlateIM::Spacer({12.f, 0.f});
+	SlateIM::Text(StatusText);
+	SlateIM::EndHorizontalStack();
+
+	{
+		FScopeLock Lock(&SnapshotLock);
+		if (ReceivedSnapshot.IsSet())
+		{
+			DrawnSnapshot = MoveTemp(ReceivedSnapshot.GetValue());
+			ReceivedSnapshot.Reset();
+		}
+	}
+
+	KaosSlateIM::DrawLabledText(TEXT("Frame"), FString::Printf(TEXT("%llu (skipped %d, malformed %d)"), DrawnSnapshot.FrameNumber, SkippedFrames.load(), MalformedFrames.load()));
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTabGroup(TEXT("RemoteTabGroup"));
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTabStack();
+
+	for (const FKaosRemoteTabSnapshot& Tab : DrawnSnapshot.Tabs)
+	{
+		if (SlateIM::BeginTab(FName(*Tab.TabLabel), FSlateIcon(), FText::FromString(Tab.TabLabel)))
+		{
+			SlateIM::Fill();
+			SlateIM::HAlign(HAlign_Fill);
+			SlateIM::VAlign(VAlign_Fill);
+			SlateIM::BeginScrollBox();
+			SlateIM::BeginVerticalStack();
+			for (const FKaosDebugLine& Line : Tab.Lines)
+			{
+				KaosSlateIM::DebugLine(Line);
+			}
+			SlateIM::EndVerticalStack();
+			SlateIM::EndScrollBox();
+		}
+		SlateIM::EndTab();
+	}
+
+	SlateIM::EndTabStack();
+	SlateIM::EndTabGroup();
+	SlateIM::EndVerticalStack();
+}
+#endif
@@ -27,6 +27,7 @@ struct FKaosWorldDebugger_Actor_AdditionalInfo : public IKaosDebuggerBaseItem
 {
 public:
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
 	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Additional Info")); }
 	virtual FSlateIcon GetTabIcon() const override;;
 };
@@ -31,6 +31,7 @@ struct FKaosWorldDebugger_Actor_Details : public IKaosDebuggerBaseItem
 {
 public:
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
 	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Details")); }
 	virtual FSlateIcon GetTabIcon() const override;;
 };
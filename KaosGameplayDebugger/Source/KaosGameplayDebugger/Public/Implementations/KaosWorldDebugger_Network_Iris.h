@@ -0,0 +1,77 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerStats.h"
+
+class UNetDriver;
+
+struct FKaosWorldDebugger_Network_Iris : public IKaosDebuggerBaseItem
+{
+public:
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
+
+private:
+	struct FKaosReplicatedClassInfo
+	{
+		FString ClassName;
+		int32 ObjectCount = 0;
+		int32 ProtocolCount = 0;
+		/** Objects that had a protocol, the totals below are summed over these */
+		int32 ProtocolObjectCount = 0;
+		int64 TotalStateCount = 0;
+		int64 TotalChangeMaskBits = 0;
+		uint64 TotalStateBytes = 0;
+	};
+
+	struct FKaosReplicationStatsCache
+	{
+		bool bUsingIris = false;
+		int32 ReplicatedObjectCount = 0;
+		int32 ReplicatedSubObjectCount = 0;
+		int32 ProtocolCount = 0;
+		int32 ActiveObjectCount = 0;
+		int32 DormantObjectCount = 0;
+		TArray<FKaosReplicatedClassInfo> Classes;
+		TArray<FKaosStatValue> NetStats;
+		double TimeSinceLastGather = TNumericLimits<double>::Max();
+	};
+
+	TMap<TWeakObjectPtr<UWorld>, FKaosReplicationStatsCache> CachedStats;
+	float RefreshInterval = .5f;
+
+	void GatherIfNeeded(UWorld* World, FKaosReplicationStatsCache& Cache, float DeltaTime);
+	void GatherIris(UWorld* World, UNetDriver* NetDriver, FKaosReplicationStatsCache& Cache);
+	void GatherLegacy(UNetDriver* NetDriver, FKaosReplicationStatsCache& Cache);
+	void GatherStats(FKaosReplicationStatsCache& Cache);
+
+	void DrawClassTable(const FKaosReplicationStatsCache& Cache);
+	void DrawStatTable(const TArray<FKaosStatValue>& Stats);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Replication System")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+
+#endif
@@ -0,0 +1,97 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerWorldRollup.h"
+
+struct FKaosWorldDebugger_Network_SubObjects : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_Network_SubObjects();
+
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
+
+private:
+	/** What can be known about a class without looking at an instance, computed once per class */
+	struct FKaosClassLayout
+	{
+		bool bUsesRegisteredList = false;
+		int32 NumRepProperties = 0;
+	};
+
+	struct FKaosActorCensus
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FString ActorName;
+		int32 Components = 0;
+		int32 LegacyComponents = 0;
+		int32 SubObjects = 0;
+		int32 RepProperties = 0;
+	};
+
+	struct FKaosClassCensus
+	{
+		TWeakObjectPtr<UClass> Class;
+		FString ClassName;
+		bool bUsesRegisteredList = false;
+		int32 ActorCount = 0;
+		int32 Components = 0;
+		int32 LegacyComponents = 0;
+		int32 SubObjects = 0;
+		int32 RepProperties = 0;
+		TArray<FKaosActorCensus> Actors;
+	};
+
+	struct FKaosCensusResult
+	{
+		TArray<FKaosClassCensus> Classes;
+		TMap<TWeakObjectPtr<UClass>, int32> ClassIndices;
+		int32 TotalActors = 0;
+		int32 TotalComponents = 0;
+		int32 TotalSubObjects = 0;
+	};
+
+	TKaosWorldRollup<AActor, FKaosCensusResult> Census;
+	TMap<TWeakObjectPtr<UClass>, FKaosClassLayout> ClassLayouts;
+	TWeakObjectPtr<UWorld> CensusWorld;
+
+	/** Kept by class rather than row, every pass re-sorts the rows */
+	TWeakObjectPtr<UClass> SelectedClass;
+	TWeakObjectPtr<AActor> SelectedActor;
+
+	void TickCensus(UWorld* World, float DeltaTime);
+	void ProcessActor(const TWeakObjectPtr<AActor>& WeakActor, FKaosCensusResult& Result);
+	const FKaosClassLayout& GetClassLayout(UClass* Class);
+	static int32 CountRegisteredSubObjects(AActor* Actor, TArray<FString>* OutNames = nullptr);
+
+	void DrawClassTable(const FKaosCensusResult& Result);
+	void DrawActorTable(const FKaosClassCensus& ClassCensus);
+	void DrawSelectedActor();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("SubObject Census")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+
+#endif
@@ -31,6 +31,7 @@ struct FKaosWorldDebugger_World_Details : public IKaosDebuggerBaseItem
 {
 public:
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
 
 private:
 
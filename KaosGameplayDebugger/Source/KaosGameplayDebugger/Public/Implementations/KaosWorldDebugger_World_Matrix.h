@@ -0,0 +1,78 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+#include "Engine/EngineBaseTypes.h"
+
+/** Side by side comparison of every game / PIE world, one column per world */
+struct FKaosWorldDebugger_World_Matrix : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_World_Matrix();
+
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
+
+private:
+	struct FKaosWorldColumn
+	{
+		TWeakObjectPtr<UWorld> World;
+		FString Label;
+		int32 ActorCount = 0;
+		int32 ReplicatedCount = 0;
+		TArray<int32> DormancyCounts;
+		TArray<FKaosDebugLine> ExtensionLines;
+		/** Each column refreshes on its own clock, offset from the others */
+		double TimeUntilGather = 0;
+		bool bHasData = false;
+	};
+
+	struct FKaosWorldTickTiming
+	{
+		double TickStartTime = 0;
+		double LastTickMs = 0;
+		double AverageTickMs = 0;
+	};
+
+	TArray<FKaosWorldColumn> Columns;
+	TMap<TWeakObjectPtr<UWorld>, FKaosWorldTickTiming> TickTimings;
+	FDelegateHandle TickStartHandle;
+	FDelegateHandle PostActorTickHandle;
+	float RefreshInterval = 1.f;
+
+	void BindTickDelegates();
+	void RefreshColumns();
+	void GatherDueColumns(float DeltaTime);
+	static void GatherActorCounts(UWorld* World, FKaosWorldColumn& Column);
+
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void DrawRow(const FString& Label, TFunctionRef<FString(const FKaosWorldColumn&)> GetValue);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("World Matrix")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+
+#endif
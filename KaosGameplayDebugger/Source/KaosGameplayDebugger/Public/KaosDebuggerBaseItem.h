@@ -24,6 +24,7 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 
 #include "KaosDebuggerContext.h"
+#include "KaosGameplayDebuggerInfoProviderInterface.h"
 #include "SlateIM.h"
 #include "Styling/SlateTypes.h"
 #include "Brushes/SlateColorBrush.h"
@@ -41,6 +42,9 @@ public:
 
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) = 0;
 
+	/** Flat text version of what DrawDetails shows, streamed to the remote viewer. Tabs that don't override it are skipped. */
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) {}
+
 	int32 GetTabOrder() const { return TabOrder; }
 	
 private:
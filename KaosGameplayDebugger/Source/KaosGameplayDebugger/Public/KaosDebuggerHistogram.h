@@ -0,0 +1,63 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+/**
+ * Fixed size histogram with power of two buckets, cheap enough to feed from gameplay callbacks.
+ * Bucket 0 holds everything below MinValue, every following bucket covers twice the range of the one before it,
+ * so a handful of buckets spans sub millisecond to multi minute values at a constant relative precision.
+ */
+class KAOSGAMEPLAYDEBUGGER_API FKaosLogHistogram
+{
+public:
+	static constexpr int32 NumBuckets = 24;
+
+	explicit FKaosLogHistogram(double InMinValue = 0.0001);
+
+	void Add(double Value);
+	void Reset();
+
+	int32 GetCount() const { return Count; }
+	double GetMin() const { return Count > 0 ? Min : 0.0; }
+	double GetMax() const { return Count > 0 ? Max : 0.0; }
+	double GetMean() const { return Count > 0 ? Sum / Count : 0.0; }
+
+	/** Upper bound of the bucket the percentile falls into, Percentile is in the 0-1 range */
+	double GetPercentile(double Percentile) const;
+
+	int32 GetBucketCount(int32 BucketIndex) const { return Buckets[BucketIndex]; }
+	int32 GetLargestBucketCount() const;
+	double GetBucketLowerBound(int32 BucketIndex) const;
+	double GetBucketUpperBound(int32 BucketIndex) const;
+
+private:
+	double MinValue;
+	int32 Buckets[NumBuckets];
+	int32 Count = 0;
+	double Sum = 0.0;
+	double Min = 0.0;
+	double Max = 0.0;
+
+	int32 GetBucketIndex(double Value) const;
+};
+#endif
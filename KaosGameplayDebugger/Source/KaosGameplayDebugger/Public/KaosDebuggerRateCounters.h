@@ -0,0 +1,195 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+
+/**
+ * Fixed capacity table of event counters keyed by KeyType, with a windowed rate and peak rate per row.
+ * Row 0 is shared by every key past the capacity, so counting never allocates once the table is full.
+ * Each row keeps NumChannels counters, for callers that count several kinds of event against the same key.
+ */
+template<typename KeyType, typename RowDataType, int32 NumChannels = 1>
+class TKaosRateCounters
+{
+public:
+	static constexpr int32 OverflowIndex = 0;
+
+	struct FRow
+	{
+		RowDataType Data;
+		uint32 Counts[NumChannels] = {};
+		float Rates[NumChannels] = {};
+		float PeakRates[NumChannels] = {};
+		/** Counts at the last sample, the next rate is the difference over the window */
+		uint32 SampledCounts[NumChannels] = {};
+
+		uint32 GetTotalCount() const
+		{
+			uint32 Total = 0;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Total += Counts[Channel];
+			}
+			return Total;
+		}
+
+		float GetTotalRate() const
+		{
+			float Total = 0.f;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Total += Rates[Channel];
+			}
+			return Total;
+		}
+	};
+
+	TKaosRateCounters(int32 InMaxRows, const RowDataType& InOverflowData)
+		: OverflowData(InOverflowData)
+		, MaxRows(InMaxRows)
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		Rows.Reset(MaxRows + 1);
+		Rows.AddDefaulted_GetRef().Data = OverflowData;
+		RowIndices.Reset();
+		SortedIndices.Reset();
+		LastSampleTime = -1.0;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			TotalRates[Channel] = 0.f;
+			PeakTotalRates[Channel] = 0.f;
+		}
+	}
+
+	/** Row for Key, or the overflow row once the table is full. InitRow fills in the data of a newly added row. */
+	int32 FindOrAddRow(const KeyType& Key, TFunctionRef<void(RowDataType& Data)> InitRow)
+	{
+		if (const int32* Found = RowIndices.Find(Key))
+		{
+			return *Found;
+		}
+
+		if (Rows.Num() > MaxRows)
+		{
+			return OverflowIndex;
+		}
+
+		const int32 Index = Rows.AddDefaulted();
+		InitRow(Rows[Index].Data);
+		RowIndices.Add(Key, Index);
+		return Index;
+	}
+
+	void Count(int32 Index, int32 Channel = 0)
+	{
+		++Rows[Index].Counts[Channel];
+	}
+
+	/** Samples the rates once RateWindow seconds have passed since the last sample, Now is in seconds */
+	void Tick(double Now, float RateWindow)
+	{
+		if (LastSampleTime < 0.0 || Now < LastSampleTime)
+		{
+			LastSampleTime = Now;
+		}
+		else if (Now - LastSampleTime >= RateWindow)
+		{
+			SampleRates(Now);
+		}
+	}
+
+	FRow& GetRow(int32 Index) { return Rows[Index]; }
+	const FRow& GetRow(int32 Index) const { return Rows[Index]; }
+	int32 Num() const { return Rows.Num(); }
+
+	/** Rows that counted anything, highest rate first, as of the last sample */
+	const TArray<int32>& GetSortedIndices() const { return SortedIndices; }
+
+	float GetTotalRate(int32 Channel = 0) const { return TotalRates[Channel]; }
+	float GetPeakTotalRate(int32 Channel = 0) const { return PeakTotalRates[Channel]; }
+
+	uint32 GetTotalCount(int32 Channel = 0) const
+	{
+		uint32 Total = 0;
+		for (const FRow& Row : Rows)
+		{
+			Total += Row.Counts[Channel];
+		}
+		return Total;
+	}
+
+private:
+	TArray<FRow> Rows;
+	TMap<KeyType, int32> RowIndices;
+	TArray<int32> SortedIndices;
+	RowDataType OverflowData;
+	int32 MaxRows = 0;
+	double LastSampleTime = -1.0;
+	float TotalRates[NumChannels] = {};
+	float PeakTotalRates[NumChannels] = {};
+
+	void SampleRates(double Now)
+	{
+		const float Elapsed = static_cast<float>(Now - LastSampleTime);
+		LastSampleTime = Now;
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			TotalRates[Channel] = 0.f;
+		}
+
+		SortedIndices.Reset(Rows.Num());
+		for (int32 Index = 0; Index < Rows.Num(); ++Index)
+		{
+			FRow& Row = Rows[Index];
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Row.Rates[Channel] = (Row.Counts[Channel] - Row.SampledCounts[Channel]) / Elapsed;
+				Row.PeakRates[Channel] = FMath::Max(Row.PeakRates[Channel], Row.Rates[Channel]);
+				Row.SampledCounts[Channel] = Row.Counts[Channel];
+				TotalRates[Channel] += Row.Rates[Channel];
+			}
+
+			if (Row.GetTotalCount() > 0)
+			{
+				SortedIndices.Add(Index);
+			}
+		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			PeakTotalRates[Channel] = FMath::Max(PeakTotalRates[Channel], TotalRates[Channel]);
+		}
+
+		SortedIndices.Sort([this](int32 A, int32 B)
+		{
+			const float RateA = Rows[A].GetTotalRate();
+			const float RateB = Rows[B].GetTotalRate();
+			return RateA != RateB ? RateA > RateB : Rows[A].GetTotalCount() > Rows[B].GetTotalCount();
+		});
+	}
+};
+#endif
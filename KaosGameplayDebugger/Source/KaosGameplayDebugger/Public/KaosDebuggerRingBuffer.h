@@ -0,0 +1,95 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+
+/**
+ * Fixed capacity FIFO that overwrites its oldest element once full.
+ * Storage is allocated up front so the memory a buffer can ever use is known when it is created.
+ */
+template<typename T>
+class TKaosRingBuffer
+{
+public:
+	explicit TKaosRingBuffer(int32 InCapacity = 0)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	/** Reallocates the storage, dropping every element */
+	void SetCapacity(int32 InCapacity)
+	{
+		Elements.Empty(FMath::Max(InCapacity, 0));
+		Elements.SetNum(FMath::Max(InCapacity, 0));
+		Head = 0;
+		Count = 0;
+	}
+
+	void Push(const T& Element)
+	{
+		if (Elements.IsEmpty())
+		{
+			return;
+		}
+
+		if (Count < Elements.Num())
+		{
+			Elements[(Head + Count) % Elements.Num()] = Element;
+			++Count;
+		}
+		else
+		{
+			Elements[Head] = Element;
+			Head = (Head + 1) % Elements.Num();
+		}
+		++TotalPushed;
+	}
+
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+	/** Index 0 is the oldest element */
+	const T& operator[](int32 Index) const
+	{
+		check(Index >= 0 && Index < Count);
+		return Elements[(Head + Index) % Elements.Num()];
+	}
+
+	const T& Last() const { return (*this)[Count - 1]; }
+	int32 Num() const { return Count; }
+	int32 Capacity() const { return Elements.Num(); }
+	bool IsEmpty() const { return Count == 0; }
+	bool IsFull() const { return Count == Elements.Num(); }
+	/** Ever increasing, lets callers tell whether anything was pushed since they last looked */
+	uint64 GetTotalPushed() const { return TotalPushed; }
+	SIZE_T GetAllocatedSize() const { return Elements.GetAllocatedSize(); }
+
+private:
+	TArray<T> Elements;
+	int32 Head = 0;
+	int32 Count = 0;
+	uint64 TotalPushed = 0;
+};
+#endif
@@ -0,0 +1,50 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+struct FKaosStatValue
+{
+	FName StatName;
+	FString Description;
+	bool bIsCycle = false;
+	/** Milliseconds for cycle stats, raw value for counters */
+	double Average = 0.0;
+	double Max = 0.0;
+	/** Number of calls this frame, only meaningful for cycle stats */
+	int32 CallCount = 0;
+};
+
+/**
+ * Read access to the stats frame the engine already publishes for "stat <Group>" display.
+ * Values only exist for groups currently enabled, and never in builds without STATS.
+ */
+namespace KaosDebuggerStats
+{
+	KAOSGAMEPLAYDEBUGGER_API bool AreStatsAvailable();
+	KAOSGAMEPLAYDEBUGGER_API bool IsGroupActive(FName GroupName);
+	KAOSGAMEPLAYDEBUGGER_API void GetActiveGroupNames(TArray<FName>& OutGroupNames);
+	KAOSGAMEPLAYDEBUGGER_API bool FindStat(FName StatName, FKaosStatValue& OutValue);
+	KAOSGAMEPLAYDEBUGGER_API void GetGroupStats(FName GroupName, TArray<FKaosStatValue>& OutValues);
+}
+#endif
@@ -0,0 +1,120 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "HAL/PlatformTime.h"
+
+/**
+ * Spreads a gather over several frames within a per frame time budget.
+ * Results are double buffered: a pass builds into a back buffer and only replaces
+ * the published results once every item has been processed, so drawing never sees a partial pass.
+ */
+template<typename ItemType, typename ResultType>
+class TKaosTimeSlicer
+{
+public:
+	using FProcessItem = TFunction<void(const ItemType& Item, ResultType& Result)>;
+	using FFinishPass = TFunction<void(ResultType& Result)>;
+
+	explicit TKaosTimeSlicer(FProcessItem InProcessItem, FFinishPass InFinishPass = nullptr)
+		: ProcessItem(MoveTemp(InProcessItem))
+		, FinishPass(MoveTemp(InFinishPass))
+	{
+	}
+
+	/** Starts a new pass over Items, dropping any pass still in flight */
+	void Start(TArray<ItemType>&& Items)
+	{
+		PendingItems = MoveTemp(Items);
+		NextItemIndex = 0;
+		BackBuffer = ResultType();
+		bRunning = true;
+	}
+
+	/** Processes items until the budget runs out, returns true when this call completed a pass */
+	bool Tick(double BudgetSeconds)
+	{
+		if (!bRunning)
+		{
+			return false;
+		}
+
+		const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+		while (NextItemIndex < PendingItems.Num())
+		{
+			ProcessItem(PendingItems[NextItemIndex++], BackBuffer);
+			if (FPlatformTime::Seconds() >= EndTime)
+			{
+				break;
+			}
+		}
+
+		if (NextItemIndex < PendingItems.Num())
+		{
+			return false;
+		}
+
+		if (FinishPass)
+		{
+			FinishPass(BackBuffer);
+		}
+		Swap(FrontBuffer, BackBuffer);
+		BackBuffer = ResultType();
+		PendingItems.Reset();
+		bRunning = false;
+		++CompletedPasses;
+		return true;
+	}
+
+	/** Drops the pass in flight, the last published results stay */
+	void Cancel()
+	{
+		PendingItems.Reset();
+		BackBuffer = ResultType();
+		bRunning = false;
+	}
+
+	/** Drops the pass in flight and the published results, for when they no longer describe what is being gathered */
+	void Reset()
+	{
+		Cancel();
+		FrontBuffer = ResultType();
+		CompletedPasses = 0;
+	}
+
+	bool IsRunning() const { return bRunning; }
+	bool HasResults() const { return CompletedPasses > 0; }
+	int32 GetCompletedPasses() const { return CompletedPasses; }
+	float GetProgress() const { return PendingItems.Num() > 0 ? static_cast<float>(NextItemIndex) / PendingItems.Num() : 1.f; }
+	const ResultType& GetResults() const { return FrontBuffer; }
+
+private:
+	FProcessItem ProcessItem;
+	FFinishPass FinishPass;
+	TArray<ItemType> PendingItems;
+	int32 NextItemIndex = 0;
+	ResultType FrontBuffer;
+	ResultType BackBuffer;
+	bool bRunning = false;
+	int32 CompletedPasses = 0;
+};
+#endif
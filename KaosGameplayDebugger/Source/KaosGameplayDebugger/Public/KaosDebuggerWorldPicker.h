@@ -0,0 +1,54 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Styling/SlateTypes.h"
+
+/**
+ * The auto refresh / interval / world combo row shared by the main tabs that work on one game or PIE world.
+ */
+class KAOSGAMEPLAYDEBUGGER_API FKaosDebuggerWorldPicker
+{
+public:
+	/** Draws the picker as its own horizontal row and refreshes the world list when due */
+	void Draw(float DeltaTime);
+
+	/** The picked world, refreshing the list first if it was never drawn (e.g. when only streaming) */
+	UWorld* GetSelectedWorld();
+
+	/** Game and PIE worlds in world context order */
+	static void GetDebuggableWorlds(TArray<UWorld*>& OutWorlds);
+
+	/** World name with its PIE instance and net mode, e.g. "Lvl_Arena [PIE:1] (Client)" */
+	static FString GetWorldLabel(const UWorld* World);
+
+private:
+	void RefreshWorldList();
+
+	double TimeSinceLastUpdate = 0;
+	ECheckBoxState ShouldAutoRefresh = ECheckBoxState::Checked;
+	float RefreshInterval = .5f;
+	int32 SelectedWorldIndex = INDEX_NONE;
+	TArray<TWeakObjectPtr<UWorld>> WorldList;
+	bool bForceWorldComboRefresh = true;
+};
+#endif
@@ -0,0 +1,142 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Engine/World.h"
+#include "KaosDebuggerTimeSlicer.h"
+#include "SlateIM.h"
+#include "UObject/UObjectHash.h"
+
+/**
+ * Periodic census of every ObjectType in one world.
+ * Instances are found through the class hash in one go, which only touches objects of that class, then each one goes
+ * through a TKaosTimeSlicer so the per object work never costs more than the budget on any frame. Owns the world,
+ * pass interval and budget, and their controls, so a tab only supplies the per object work.
+ */
+template<typename ObjectType, typename ResultType>
+class TKaosWorldRollup
+{
+public:
+	using FProcessObject = TFunction<void(const TWeakObjectPtr<ObjectType>& Object, ResultType& Result)>;
+	using FFinishPass = TFunction<void(ResultType& Result)>;
+	using FFilterObject = TFunction<bool(const ObjectType* Object)>;
+
+	explicit TKaosWorldRollup(FProcessObject InProcessObject, FFinishPass InFinishPass = nullptr, FFilterObject InFilterObject = nullptr, float InPassInterval = 2.f)
+		: Slicer(MoveTemp(InProcessObject), MoveTemp(InFinishPass))
+		, FilterObject(MoveTemp(InFilterObject))
+		, PassInterval(InPassInterval)
+	{
+	}
+
+	/** Advances the current pass or starts the next one, at most once per frame however many callers tick it */
+	void Tick(UWorld* World, float DeltaTime)
+	{
+		if (LastTickFrame == GFrameCounter)
+		{
+			return;
+		}
+		LastTickFrame = GFrameCounter;
+
+		if (RollupWorld != World)
+		{
+			// Results from another world would be misleading until the first pass here completes
+			Slicer.Reset();
+			RollupWorld = World;
+			TimeSinceLastPass = TNumericLimits<double>::Max();
+		}
+
+		if (!World)
+		{
+			return;
+		}
+
+		const double EndTime = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+		if (!Slicer.IsRunning())
+		{
+			TimeSinceLastPass += DeltaTime;
+			if (TimeSinceLastPass < PassInterval)
+			{
+				return;
+			}
+
+			TimeSinceLastPass = 0;
+			Slicer.Start(FindObjects(World));
+		}
+
+		Slicer.Tick(FMath::Max(EndTime - FPlatformTime::Seconds(), 0.0));
+	}
+
+	/** Pass interval, budget and progress on one row */
+	void DrawControls()
+	{
+		SlateIM::BeginHorizontalStack();
+		SlateIM::Text(TEXT("Pass Interval (s):"));
+		SlateIM::MinWidth(60.f);
+		SlateIM::SpinBox(PassInterval, 0.5f, 30.f);
+		SlateIM::Spacer({12.f, 0.f});
+		SlateIM::Text(TEXT("Budget (ms/frame):"));
+		SlateIM::MinWidth(60.f);
+		SlateIM::SpinBox(BudgetMs, 0.1f, 10.f);
+		SlateIM::Spacer({12.f, 0.f});
+		if (Slicer.IsRunning())
+		{
+			SlateIM::Text(FString::Printf(TEXT("Gathering %.0f%%"), Slicer.GetProgress() * 100.f));
+		}
+		else
+		{
+			SlateIM::Text(FString::Printf(TEXT("Pass %d complete"), Slicer.GetCompletedPasses()));
+		}
+		SlateIM::EndHorizontalStack();
+	}
+
+	bool IsRunning() const { return Slicer.IsRunning(); }
+	bool HasResults() const { return Slicer.HasResults(); }
+	int32 GetCompletedPasses() const { return Slicer.GetCompletedPasses(); }
+	const ResultType& GetResults() const { return Slicer.GetResults(); }
+
+private:
+	TKaosTimeSlicer<TWeakObjectPtr<ObjectType>, ResultType> Slicer;
+	FFilterObject FilterObject;
+	TWeakObjectPtr<UWorld> RollupWorld;
+	double TimeSinceLastPass = TNumericLimits<double>::Max();
+	uint64 LastTickFrame = MAX_uint64;
+	float PassInterval = 2.f;
+	float BudgetMs = 1.f;
+
+	TArray<TWeakObjectPtr<ObjectType>> FindObjects(const UWorld* World) const
+	{
+		TArray<UObject*> Objects;
+		GetObjectsOfClass(ObjectType::StaticClass(), Objects, true, RF_ClassDefaultObject, EInternalObjectFlags::Garbage);
+
+		TArray<TWeakObjectPtr<ObjectType>> FoundObjects;
+		for (UObject* Object : Objects)
+		{
+			ObjectType* TypedObject = CastChecked<ObjectType>(Object);
+			if (TypedObject->GetWorld() == World && (!FilterObject || FilterObject(TypedObject)))
+			{
+				FoundObjects.Add(TypedObject);
+			}
+		}
+		return FoundObjects;
+	}
+};
+#endif
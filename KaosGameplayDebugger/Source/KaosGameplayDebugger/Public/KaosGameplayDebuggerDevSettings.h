@@ -48,4 +48,12 @@ public:
 
 	UPROPERTY(EditAnywhere, Config, Category=Interaction)
 	TEnumAsByte<ETraceTypeQuery> MouseUnderCursorTraceChannel;
+
+	/** Localhost port used by KaosDebugger.Remote.Start when no port is given */
+	UPROPERTY(EditAnywhere, Config, Category=Remote, meta=(ClampMin=1024, ClampMax=65535))
+	int32 RemoteStreamPort = 41950;
+
+	/** Seconds between two snapshots sent to the remote viewer */
+	UPROPERTY(EditAnywhere, Config, Category=Remote, meta=(ClampMin=0.0))
+	float RemoteSnapshotInterval = 0.1f;
 };
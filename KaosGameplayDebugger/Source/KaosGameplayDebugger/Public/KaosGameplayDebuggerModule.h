@@ -24,6 +24,8 @@
 #include "KaosDebuggerBaseItem.h"
 #include "KaosGameplayDebuggerWidget.h"
 #include "Modules/ModuleManager.h"
+#include "Remote/KaosDebuggerRemoteServer.h"
+#include "Remote/KaosDebuggerRemoteViewer.h"
 
 
 struct KAOSGAMEPLAYDEBUGGER_API FKaosDebuggerMainCategoryHandle
@@ -66,6 +68,10 @@ private:
 };
 
 
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+DECLARE_MULTICAST_DELEGATE_TwoParams(FKaosOnCollectWorldStats, UWorld* /*World*/, TArray<FKaosDebugLine>& /*OutLines*/);
+#endif
+
 class KAOSGAMEPLAYDEBUGGER_API FKaosGameplayDebuggerModule : public IModuleInterface
 {
 public:
@@ -99,8 +105,23 @@ public:
 	TArray<TSharedPtr<IKaosDebuggerBaseItem>> GetRegisteredSubCategoriesFor(FName Category) const;
 	const TArray<TSharedPtr<IKaosDebuggerBaseItem>> GetRegisteredMainTabs() const;;
 
+	/** Gathers the snapshot of every sub tab registered under Category, each prefixed by a header with its label */
+	void CollectSubCategorySnapshots(FName Category, const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) const;
+
 	void ToggleCheatUI(UWorld* World);
 
+	/** Lets extension modules add their own per world rows to the World Matrix, broadcast on the game thread */
+	FKaosOnCollectWorldStats& OnCollectWorldStats() { return CollectWorldStatsDelegate; }
+
+	/** Asks the Actor tab to inspect Actor, picked up the next time that tab draws */
+	void SelectActor(AActor* Actor) { RequestedActorSelection = Actor; }
+	AActor* ConsumeActorSelectionRequest();
+
+	/** Starts streaming tab snapshots to out of process viewers, Port <= 0 uses the dev settings port. */
+	bool StartRemoteStream(int32 Port = 0);
+	void StopRemoteStream();
+	bool IsRemoteStreaming() const { return RemoteServer.IsValid() && RemoteServer->IsRunning(); }
+
 	[[nodiscard]] FKaosDebuggerMainCategoryHandle RegisterMainCategory(FName Category, TSharedPtr<IKaosDebuggerBaseItem> Instance, int32 IndexOrder);
 	[[nodiscard]] FKaosDebuggerSubCategoryHandle RegisterSubCategory(FName MainCategory, FName SubCategoryName, TSharedPtr<IKaosDebuggerBaseItem> Instance, int32 IndexOrder);
 
@@ -117,6 +138,12 @@ private:
 	TMap<TWeakObjectPtr<class ULocalPlayer>, TSharedPtr<FKaosSlateCheatWidget>> LocalPlayerToWidgetMap;
 	FDelegateHandle BoundHandle;
 	FKaosGameplayDebuggerWidget KaosGameplayDebuggerWidget;
+
+	TUniquePtr<FKaosDebuggerRemoteServer> RemoteServer;
+	FKaosDebuggerRemoteViewer RemoteViewer;
+
+	FKaosOnCollectWorldStats CollectWorldStatsDelegate;
+	TWeakObjectPtr<AActor> RequestedActorSelection;
 	
 	TArray<FKaosDebuggerMainCategoryHandle> RegisteredMainCategories;
 	TArray<FKaosDebuggerSubCategoryHandle> RegisteredSubCategories;
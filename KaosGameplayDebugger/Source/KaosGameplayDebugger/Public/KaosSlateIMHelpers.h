@@ -22,6 +22,9 @@
 
 #include "CoreMinimal.h"
 #include "SlateIM.h"
+#include "KaosGameplayDebuggerInfoProviderInterface.h"
+
+class FKaosLogHistogram;
 
 namespace KaosSlateIM
 {
@@ -37,5 +40,8 @@ namespace KaosSlateIM
 	KAOSGAMEPLAYDEBUGGER_API void DrawLabledText(const FStringView& Label, FSlateColor LabelColor, const FStringView& Text);
 	KAOSGAMEPLAYDEBUGGER_API void DrawLabledText(const FStringView& Label, FSlateColor LabelColor, const FStringView& Text, FSlateColor TextColor);
 	KAOSGAMEPLAYDEBUGGER_API void DrawLabledText(const FStringView& Label, const FStringView& Text, FSlateColor TextColor);
+	KAOSGAMEPLAYDEBUGGER_API void DebugLine(const FKaosDebugLine& Line);
+	/** Summary plus one bar per populated bucket, Histogram values are taken to be seconds and shown in ms */
+	KAOSGAMEPLAYDEBUGGER_API void DrawHistogram(const FStringView& Label, const FKaosLogHistogram& Histogram);
 #endif
 }
@@ -30,6 +30,7 @@ public:
 	void HandleActorSelection();
 
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
 	
 private:
 
@@ -39,6 +40,7 @@ private:
 #endif
 	
 	// Helpers
+	void SelectActor(AActor* Actor);
 	void RefreshWorldList();
 	void RefreshActorList();
 
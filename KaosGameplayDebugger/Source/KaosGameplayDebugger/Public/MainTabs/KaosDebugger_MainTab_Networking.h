@@ -23,17 +23,23 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 #include "KaosDebuggerContext.h"
 #include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerWorldPicker.h"
 
 struct FKaosDebugger_MainTab_Networking: public IKaosDebuggerBaseItem
 {
 public:
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
 	
 private:
 	
 public:
 	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Networking Info")); }
 	virtual FSlateIcon GetTabIcon() const override;;
+
+private:
+	FKaosDebuggerWorldPicker WorldPicker;
+	TWeakObjectPtr<UWorld> SelectedWorld;
 };
 
 #endif
\ No newline at end of file
@@ -23,11 +23,13 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 #include "KaosDebuggerContext.h"
 #include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerWorldPicker.h"
 
 struct FKaosDebugger_MainTab_World: public IKaosDebuggerBaseItem
 {
 public:
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
 	
 private:
 	
@@ -36,17 +38,7 @@ public:
 	virtual FSlateIcon GetTabIcon() const override;;
 
 private:
-	void RefreshWorldList();
-
-	double CurrentTime = 0;
-	double TimeSinceLastUpdate = 0;
-	
-	ECheckBoxState ShouldAutoRefresh = ECheckBoxState::Checked;
-	float RefreshInterval = .5f;
-	bool bRefreshAll = false;
-	int32 SelectedWorldIndex = INDEX_NONE;
-	TArray<TWeakObjectPtr<UWorld>> WorldList;
-	bool bForceWorldComboRefresh = true;
+	FKaosDebuggerWorldPicker WorldPicker;
 	TWeakObjectPtr<UWorld> SelectedWorld;
 };
 
@@ -0,0 +1,65 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosGameplayDebuggerInfoProviderInterface.h"
+
+/**
+ * Wire format used between the in-game snapshot server and the out of process viewer.
+ *
+ * Every frame is a fixed 12 byte header followed by the payload:
+ *   uint32 Magic | uint16 ProtocolVersion | uint16 Reserved | uint32 PayloadSize
+ * All values are little endian. Viewers drop frames with an unknown magic or version.
+ */
+namespace KaosDebuggerRemote
+{
+	static constexpr uint32 FrameMagic = 0x4B474442; // 'KGDB'
+	static constexpr uint16 ProtocolVersion = 1;
+	static constexpr int32 FrameHeaderSize = 12;
+	static constexpr uint32 MaxPayloadSize = 16 * 1024 * 1024;
+}
+
+struct KAOSGAMEPLAYDEBUGGER_API FKaosRemoteTabSnapshot
+{
+	FString TabLabel;
+	TArray<FKaosDebugLine> Lines;
+};
+
+struct KAOSGAMEPLAYDEBUGGER_API FKaosRemoteSnapshot
+{
+	uint64 FrameNumber = 0;
+	double CaptureTime = 0.0;
+	TArray<FKaosRemoteTabSnapshot> Tabs;
+};
+
+namespace KaosDebuggerRemote
+{
+	/** Serializes a snapshot into a complete frame (header + payload) ready to be sent. */
+	KAOSGAMEPLAYDEBUGGER_API void WriteFrame(const FKaosRemoteSnapshot& Snapshot, TArray<uint8>& OutFrame);
+
+	/** Validates a frame header, returns false if the magic, version or size is not acceptable. */
+	KAOSGAMEPLAYDEBUGGER_API bool ReadFrameHeader(const uint8* Header, uint32& OutPayloadSize);
+
+	/** Deserializes a payload previously produced by WriteFrame. */
+	KAOSGAMEPLAYDEBUGGER_API bool ReadPayload(const TArray<uint8>& Payload, FKaosRemoteSnapshot& OutSnapshot);
+}
+#endif
@@ -0,0 +1,81 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+class FSocket;
+class FTcpListener;
+struct FIPv4Endpoint;
+struct FKaosRemoteSnapshot;
+
+/**
+ * Streams tab snapshots to out of process viewers over a localhost TCP socket.
+ * The game thread only collects and serializes, sending happens on a background task with non blocking
+ * sockets so a stalled viewer skips frames and is eventually dropped rather than holding anything up.
+ */
+class KAOSGAMEPLAYDEBUGGER_API FKaosDebuggerRemoteServer
+{
+public:
+	~FKaosDebuggerRemoteServer();
+
+	bool Start(int32 Port, float InSnapshotInterval);
+	void Stop();
+
+	bool IsRunning() const { return Listener.IsValid(); }
+	int32 GetNumClients() const { return NumClients; }
+
+private:
+	/** Send state for one viewer, only touched by the send task once the client is registered */
+	struct FKaosRemoteClient
+	{
+		FSocket* Socket = nullptr;
+		TArray<uint8> Unsent;
+		int32 UnsentOffset = 0;
+		int32 SkippedFrames = 0;
+	};
+
+	/** Consecutive frames a viewer may fall behind by before it is disconnected */
+	static constexpr int32 MaxSkippedFrames = 30;
+
+	bool HandleConnectionAccepted(FSocket* Socket, const FIPv4Endpoint& Endpoint);
+	bool Tick(float DeltaTime);
+	void CollectSnapshot(FKaosRemoteSnapshot& OutSnapshot) const;
+	void SendFrame(const TArray<uint8>& Frame);
+	static bool SendToClient(FKaosRemoteClient& Client, const TArray<uint8>& Frame);
+	static bool FlushClient(FKaosRemoteClient& Client);
+
+	FSocket* ListenSocket = nullptr;
+	TUniquePtr<FTcpListener> Listener;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FCriticalSection ClientsLock;
+	TArray<TSharedPtr<FKaosRemoteClient>> Clients;
+	std::atomic<int32> NumClients = 0;
+
+	UE::Tasks::FTask SendTask;
+	TArray<uint8> PendingFrame;
+	uint64 FrameNumber = 0;
+};
+#endif
@@ -0,0 +1,76 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "HAL/Runnable.h"
+#include <atomic>
+#include "Remote/KaosDebuggerRemoteProtocol.h"
+#include "SlateIM.h"
+#include "SlateIMWidgetBase.h"
+
+class FSocket;
+class FRunnableThread;
+
+/**
+ * Renders snapshots streamed by FKaosDebuggerRemoteServer from another process.
+ * Receiving runs on its own thread, the window only draws the latest complete snapshot.
+ */
+class KAOSGAMEPLAYDEBUGGER_API FKaosDebuggerRemoteViewer : public FSlateIMWindowBase, public FRunnable
+{
+public:
+	FKaosDebuggerRemoteViewer()
+		: FSlateIMWindowBase(TEXT("Kaos Remote Viewer"), FVector2f(900, 600), TEXT("KaosDebugger.Remote.ShowViewer"), TEXT("Opens the Kaos remote snapshot viewer"))
+	{}
+	virtual ~FKaosDebuggerRemoteViewer();
+
+	bool Connect(const FString& Address);
+	void Disconnect();
+	bool IsConnected() const { return Thread != nullptr; }
+
+	virtual void DrawWindow(float DeltaTime) override;
+
+	/** FRunnable implementation */
+	virtual uint32 Run() override;
+	virtual void Stop() override { bStopRequested = true; }
+
+private:
+	bool ReceiveExactly(uint8* Data, int32 Size);
+
+	FSocket* Socket = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopRequested = false;
+	/** Set by the reader thread when it exits, the window then joins it so IsConnected() reflects a dropped server */
+	std::atomic<bool> bReaderFinished = false;
+
+	FCriticalSection SnapshotLock;
+	TOptional<FKaosRemoteSnapshot> ReceivedSnapshot;
+	FKaosRemoteSnapshot DrawnSnapshot;
+	/** Frames that failed to deserialize */
+	std::atomic<int32> MalformedFrames = 0;
+	/** Frames the server skipped for us or that were replaced before we drew them */
+	std::atomic<int32> SkippedFrames = 0;
+	TOptional<uint64> LastReceivedFrameNumber;
+
+	FString AddressText = TEXT("127.0.0.1:41950");
+	FString StatusText;
+};
+#endif
@@ -0,0 +1,267 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "Misc/AutomationTest.h"
+#if WITH_DEV_AUTOMATION_TESTS && WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameplayEffect.h"
+#include "KaosAbilitySystemBenchmarkAttributeSets.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
+#include "KaosWorldDebugger_GameplayAbilities.h"
+#include "KaosWorldDebugger_GameplayAttributes.h"
+#include "KaosWorldDebugger_GameplayEffect.h"
+#include "UObject/UObjectHash.h"
+
+namespace KaosAbilitySystemBenchmark
+{
+	static constexpr int32 EffectCounts[] = { 10, 100, 1000 };
+	static constexpr int32 AttributeSetCounts[] = { 5, 20, 50 };
+	static constexpr int32 AbilityCounts[] = { 10, 100, 500 };
+	static constexpr int32 Iterations = 20;
+}
+
+/**
+ * Builds a synthetic Ability System Component and times the GAS tabs against it, both the row collection and the
+ * table text the draw path formats for every row. Befriended by the tabs so nothing needs a live SlateIM root.
+ */
+class FKaosAbilitySystemBenchmark
+{
+public:
+	explicit FKaosAbilitySystemBenchmark(FAutomationTestBase& InTest)
+		: Test(InTest)
+	{
+	}
+
+	void Run(UWorld* World, int32 NumEffects, int32 NumAttributeSets, int32 NumAbilities);
+
+private:
+	FAutomationTestBase& Test;
+
+	/** Runs Body once per iteration and reports the mean cost per item */
+	void Measure(const TCHAR* Name, int32 Items, TFunctionRef<void()> Setup, TFunctionRef<void()> Body);
+};
+
+void FKaosAbilitySystemBenchmark::Measure(const TCHAR* Name, int32 Items, TFunctionRef<void()> Setup, TFunctionRef<void()> Body)
+{
+	using namespace KaosAbilitySystemBenchmark;
+
+	double TotalSeconds = 0.0;
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Setup();
+		const double StartTime = FPlatformTime::Seconds();
+		Body();
+		TotalSeconds += FPlatformTime::Seconds() - StartTime;
+	}
+
+	const double MsPerRun = TotalSeconds * 1000.0 / Iterations;
+	const double NsPerItem = TotalSeconds * 1e9 / (FMath::Max(Items, 1) * static_cast<double>(Iterations));
+	Test.AddInfo(FString::Printf(TEXT("%-40s %6d items  %10.3f ms/run  %10.1f ns/item"), Name, Items, MsPerRun, NsPerItem));
+	Test.AddTelemetryData(Name, NsPerItem);
+}
+
+void FKaosAbilitySystemBenchmark::Run(UWorld* World, int32 NumEffects, int32 NumAttributeSets, int32 NumAbilities)
+{
+	// Every set needs a class of its own, GAS only ever reads the first set of a class
+	TArray<UClass*> SetClasses;
+	GetDerivedClasses(UKaosBenchmarkAttributeSetBase::StaticClass(), SetClasses);
+	SetClasses.RemoveAll([](const UClass* SetClass) { return SetClass->HasAnyClassFlags(CLASS_Abstract); });
+	SetClasses.Sort([](const UClass& A, const UClass& B) { return A.GetName() < B.GetName(); });
+	if (NumEffects < 1 || NumAbilities < 1 || NumAttributeSets < 1 || NumAttributeSets > SetClasses.Num())
+	{
+		Test.AddError(FString::Printf(TEXT("Needs at least one of everything and at most %d attribute sets."), SetClasses.Num()));
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	AActor* Owner = World->SpawnActor<AActor>(SpawnParams);
+	if (!Owner)
+	{
+		Test.AddError(TEXT("Failed to spawn the synthetic owner."));
+		return;
+	}
+
+	UAbilitySystemComponent* AbilityComp = NewObject<UAbilitySystemComponent>(Owner);
+	AbilityComp->RegisterComponent();
+	AbilityComp->InitAbilityActorInfo(Owner, Owner);
+	if (!AbilityComp->IsOwnerActorAuthoritative())
+	{
+		Test.AddError(TEXT("Needs an authoritative world to grant abilities."));
+		Owner->Destroy();
+		return;
+	}
+
+	// One infinite effect per set, each with a single modifier on its own set's Value
+	FKaosAbilitySystemDebugCache& DebugCache = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache();
+	TArray<UGameplayEffect*> SetEffects;
+	TArray<FGameplayAttribute> ValueAttributes;
+	int32 NumAttributes = 0;
+	for (int32 Index = 0; Index < NumAttributeSets; ++Index)
+	{
+		UClass* SetClass = SetClasses[Index];
+		AbilityComp->AddSpawnedAttribute(NewObject<UAttributeSet>(Owner, SetClass));
+		NumAttributes += DebugCache.GetAttributeSetMetadata(SetClass).Attributes.Num();
+
+		const FGameplayAttribute& ValueAttribute = ValueAttributes.Emplace_GetRef(FindFieldChecked<FProperty>(SetClass, TEXT("Value")));
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UGameplayEffect::StaticClass(), *FString::Printf(TEXT("KaosBenchmarkEffect_%s"), *SetClass->GetName())));
+		Effect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+		FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = ValueAttribute;
+		Modifier.ModifierOp = EGameplayModOp::Additive;
+		Modifier.ModifierMagnitude = FScalableFloat(1.f);
+		SetEffects.Add(Effect);
+	}
+
+	// Spread over the sets without stacking, so every set has effects aggregating onto it
+	TArray<FActiveGameplayEffectHandle> EffectHandles;
+	EffectHandles.Reserve(NumEffects);
+	for (int32 Index = 0; Index < NumEffects; ++Index)
+	{
+		EffectHandles.Add(AbilityComp->ApplyGameplayEffectSpecToSelf(FGameplayEffectSpec(SetEffects[Index % NumAttributeSets], AbilityComp->MakeEffectContext(), 1.f)));
+	}
+
+	for (int32 Index = 0; Index < NumAbilities; ++Index)
+	{
+		AbilityComp->GiveAbility(FGameplayAbilitySpec(UGameplayAbility::StaticClass(), 1, INDEX_NONE));
+	}
+
+	Test.TestEqual(TEXT("Active effects"), AbilityComp->GetActiveGameplayEffects().GetNumGameplayEffects(), NumEffects);
+	Test.TestEqual(TEXT("Attribute sets"), AbilityComp->GetSpawnedAttributes().Num(), NumAttributeSets);
+	Test.TestEqual(TEXT("Activatable abilities"), AbilityComp->GetActivatableAbilities().Num(), NumAbilities);
+
+	{
+		TUniquePtr<FKaosWorldDebugger_GameplayEffects> Tab;
+		Measure(TEXT("Effects: initial row build"), NumEffects,
+			[&]() { Tab = MakeUnique<FKaosWorldDebugger_GameplayEffects>(); },
+			[&]() { Tab->BindToAbilitySystem(AbilityComp); });
+		Measure(TEXT("Effects: per frame refresh"), NumEffects,
+			[&]() {},
+			[&]() { Tab->RefreshVolatileFields(AbilityComp); Tab->SortRowsIfNeeded(); });
+		Measure(TEXT("Effects: table text"), NumEffects,
+			[&]() {},
+			[&]()
+			{
+				for (const FActiveGameplayEffectHandle& Handle : Tab->SortedHandles)
+				{
+					FKaosWorldDebugger_GameplayEffects::FormatEffectRow(Tab->EffectRows.FindChecked(Handle));
+				}
+			});
+	}
+
+	{
+		TUniquePtr<FKaosWorldDebugger_GameplayAttributes> Tab;
+		Measure(TEXT("Attributes: initial row build"), NumAttributes,
+			[&]() { Tab = MakeUnique<FKaosWorldDebugger_GameplayAttributes>(); },
+			[&]() { Tab->BindToAbilitySystem(AbilityComp); });
+		Measure(TEXT("Attributes: modifying effects"), NumEffects,
+			[&]() {},
+			[&]() { Tab->CollectModifyingEffects(AbilityComp, ValueAttributes[0]); });
+		Measure(TEXT("Attributes: table text"), NumAttributes,
+			[&]() {},
+			[&]()
+			{
+				for (const FKaosWorldDebugger_GameplayAttributes::FKaosGameplayAttributeRow& Row : Tab->AttributeRows)
+				{
+					FKaosWorldDebugger_GameplayAttributes::FormatAttributeRow(Row);
+				}
+			});
+		Test.TestEqual(TEXT("Attribute rows"), Tab->AttributeRows.Num(), NumAttributes);
+	}
+
+	{
+		TUniquePtr<FKaosWorldDebugger_GameplayAbilities> Tab;
+		Measure(TEXT("Abilities: initial row build"), NumAbilities,
+			[&]() { Tab = MakeUnique<FKaosWorldDebugger_GameplayAbilities>(); },
+			[&]() { Tab->UpdateAbilityRows(AbilityComp); });
+		Measure(TEXT("Abilities: unchanged container"), NumAbilities,
+			[&]() {},
+			[&]() { Tab->UpdateAbilityRows(AbilityComp); Tab->RefreshVolatileFields(AbilityComp); });
+		Measure(TEXT("Abilities: table text"), NumAbilities,
+			[&]() {},
+			[&]()
+			{
+				for (const FGameplayAbilitySpecHandle& Handle : Tab->SortedHandles)
+				{
+					FKaosWorldDebugger_GameplayAbilities::FormatAbilityRow(Tab->AbilityRows.FindChecked(Handle));
+				}
+			});
+		Test.TestEqual(TEXT("Ability rows"), Tab->AbilityRows.Num(), NumAbilities);
+	}
+
+	// Take the effects off through GAS so its removal path runs, rather than leaving them to die with the owner
+	for (const FActiveGameplayEffectHandle& Handle : EffectHandles)
+	{
+		AbilityComp->RemoveActiveGameplayEffect(Handle);
+	}
+	Owner->Destroy();
+}
+
+/**
+ * Times the GAS tabs over a grid of effect, attribute set and ability counts. Runs headless, e.g.
+ * -nullrhi -ExecCmds="Automation RunTests KaosGameplayDebugger.AbilitySystem.Benchmark; Quit"
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FKaosAbilitySystemBenchmarkTest, "KaosGameplayDebugger.AbilitySystem.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+
+void FKaosAbilitySystemBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	using namespace KaosAbilitySystemBenchmark;
+
+	for (const int32 NumEffects : EffectCounts)
+	{
+		for (const int32 NumAttributeSets : AttributeSetCounts)
+		{
+			for (const int32 NumAbilities : AbilityCounts)
+			{
+				OutBeautifiedNames.Add(FString::Printf(TEXT("Effects%d_Sets%d_Abilities%d"), NumEffects, NumAttributeSets, NumAbilities));
+				OutTestCommands.Add(FString::Printf(TEXT("%d %d %d"), NumEffects, NumAttributeSets, NumAbilities));
+			}
+		}
+	}
+}
+
+bool FKaosAbilitySystemBenchmarkTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Counts;
+	Parameters.ParseIntoArrayWS(Counts);
+	if (Counts.Num() != 3)
+	{
+		AddError(FString::Printf(TEXT("Expected effect, attribute set and ability counts, got '%s'."), *Parameters));
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	FKaosAbilitySystemBenchmark Benchmark(*this);
+	Benchmark.Run(World, FCString::Atoi(*Counts[0]), FCString::Atoi(*Counts[1]), FCString::Atoi(*Counts[2]));
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+#endif
@@ -0,0 +1,635 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "KaosAbilitySystemBenchmarkAttributeSets.generated.h"
+
+/**
+ * Attribute sets for the KaosGameplayDebugger.AbilitySystem.Benchmark tests. GAS resolves an attribute to the first
+ * set of its class, so every set the benchmark adds has to be a class of its own to be read at all.
+ * The base declares no attributes, each subclass owns a Value and a MaxValue.
+ */
+UCLASS(Abstract, Transient, HideDropdown)
+class UKaosBenchmarkAttributeSetBase : public UAttributeSet
+{
+	GENERATED_BODY()
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet00 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet01 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet02 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet03 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet04 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet05 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet06 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet07 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet08 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet09 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet10 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet11 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet12 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet13 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet14 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet15 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet16 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet17 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet18 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet19 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet20 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet21 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet22 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet23 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet24 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet25 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet26 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet27 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet28 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet29 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet30 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet31 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet32 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet33 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet34 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet35 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet36 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet37 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet38 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet39 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet40 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet41 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet42 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet43 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet44 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet45 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet46 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet47 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet48 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
+
+UCLASS(Transient, HideDropdown)
+class UKaosBenchmarkAttributeSet49 : public UKaosBenchmarkAttributeSetBase
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGameplayAttributeData Value;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxValue;
+};
@@ -0,0 +1,189 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosAbilitySystemDebugCache.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayEffectExecutionCalculation.h"
+#include "GameplayModMagnitudeCalculation.h"
+#include "Net/UnrealNetwork.h"
+#include "UObject/UObjectGlobals.h"
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+FKaosAbilitySystemDebugCache::FKaosAbilitySystemDebugCache()
+{
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FKaosAbilitySystemDebugCache::OnReloadComplete);
+}
+
+FKaosAbilitySystemDebugCache::~FKaosAbilitySystemDebugCache()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#if WITH_EDITOR
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+#endif
+}
+
+const FKaosAbilitySystemDebugCache::FKaosAttributeSetMetadata& FKaosAbilitySystemDebugCache::GetAttributeSetMetadata(TSubclassOf<UAttributeSet> AttributeSetClass)
+{
+	BindEditorInvalidation();
+
+	UClass* Class = AttributeSetClass.Get();
+	if (const FKaosAttributeSetMetadata* Found = AttributeSetMetadata.Find(Class))
+	{
+		return *Found;
+	}
+
+	FKaosAttributeSetMetadata& Metadata = AttributeSetMetadata.Add(Class);
+	if (!Class)
+	{
+		return Metadata;
+	}
+	Metadata.ClassName = Class->GetName();
+	Metadata.PropertiesSize = Class->GetPropertiesSize();
+
+	for (TFieldIterator<FStructProperty> It(Class); It; ++It)
+	{
+		if (It->Struct && It->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+		{
+			Metadata.AttributeDataCount += It->ArrayDim;
+			Metadata.AttributeDataBytes += It->GetSize();
+		}
+	}
+
+	// Conditions are keyed by rep index, so resolve them to properties once here
+	TMap<const FProperty*, const FLifetimeProperty*> ConditionsByProperty;
+	TArray<FLifetimeProperty> LifetimeProps;
+	if (const UAttributeSet* DefaultSet = GetDefault<UAttributeSet>(Class))
+	{
+		Class->SetUpRuntimeReplicationData();
+		DefaultSet->GetLifetimeReplicatedProps(LifetimeProps);
+		for (const FLifetimeProperty& LifetimeProp : LifetimeProps)
+		{
+			if (Class->ClassReps.IsValidIndex(LifetimeProp.RepIndex))
+			{
+				ConditionsByProperty.Add(Class->ClassReps[LifetimeProp.RepIndex].Property, &LifetimeProp);
+			}
+		}
+	}
+
+	TArray<FGameplayAttribute> Attributes;
+	UAttributeSet::GetAttributesFromSetClass(Class, Attributes);
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		FKaosAttributeMetadata& AttributeMetadata = Metadata.Attributes.AddDefaulted_GetRef();
+		AttributeMetadata.Attribute = Attribute;
+		AttributeMetadata.DisplayName = FName::NameToDisplayString(Attribute.AttributeName, false);
+
+		const FProperty* Property = Attribute.GetUProperty();
+		if (const FLifetimeProperty* const* LifetimeProp = ConditionsByProperty.Find(Property))
+		{
+			AttributeMetadata.bReplicated = true;
+			AttributeMetadata.ReplicationCondition = StaticEnum<ELifetimeCondition>()->GetNameStringByValue((int64)(*LifetimeProp)->Condition);
+			AttributeMetadata.ReplicationCondition.RemoveFromStart(TEXT("COND_"));
+		}
+		else
+		{
+			AttributeMetadata.ReplicationCondition = TEXT("Not Replicated");
+		}
+		AttributeMetadata.bRepNotify = Property && Property->HasAnyPropertyFlags(CPF_RepNotify);
+	}
+
+	return Metadata;
+}
+
+const FKaosAbilitySystemDebugCache::FKaosEffectDefinitionSummary& FKaosAbilitySystemDebugCache::GetEffectDefinitionSummary(const UGameplayEffect* Definition)
+{
+	BindEditorInvalidation();
+
+	if (const FKaosEffectDefinitionSummary* Found = EffectDefinitionSummaries.Find(Definition))
+	{
+		return *Found;
+	}
+
+	FKaosEffectDefinitionSummary& Summary = EffectDefinitionSummaries.Add(Definition);
+	if (!Definition)
+	{
+		return Summary;
+	}
+	Summary.ClassName = GetNameSafe(Definition->GetClass());
+
+	for (const FGameplayModifierInfo& Modifier : Definition->Modifiers)
+	{
+		FKaosEffectModifierSummary& ModifierSummary = Summary.Modifiers.AddDefaulted_GetRef();
+		ModifierSummary.Attribute = Modifier.Attribute.AttributeName;
+		ModifierSummary.CalcType = StaticEnum<EGameplayEffectMagnitudeCalculation>()->GetNameStringByValue((int64)Modifier.ModifierMagnitude.GetMagnitudeCalculationType());
+		const UClass* CustomClass = Modifier.ModifierMagnitude.GetCustomMagnitudeCalculationClass();
+		ModifierSummary.CustomClass = CustomClass ? CustomClass->GetName() : TEXT("None");
+		ModifierSummary.Magnitude = Modifier.ModifierMagnitude;
+	}
+
+	for (const FGameplayEffectExecutionDefinition& Exec : Definition->Executions)
+	{
+		FKaosEffectExecutionSummary& ExecutionSummary = Summary.Executions.AddDefaulted_GetRef();
+		ExecutionSummary.CalculationClass = GetNameSafe(Exec.CalculationClass);
+		ExecutionSummary.PassedInTags = Exec.PassedInTags.ToStringSimple();
+		for (const FConditionalGameplayEffect& CGE : Exec.ConditionalGameplayEffects)
+		{
+			ExecutionSummary.ConditionalEffects.Add(GetNameSafe(CGE.EffectClass));
+		}
+		for (const FGameplayEffectExecutionScopedModifierInfo& Modifier : Exec.CalculationModifiers)
+		{
+			ExecutionSummary.CalculationModifiers.Add(Modifier.CapturedAttribute.ToSimpleString());
+		}
+	}
+
+	Summary.StackingType = StaticEnum<EGameplayEffectStackingType>()->GetNameStringByValue((int64)Definition->StackingType);
+	Summary.bStacks = Definition->StackingType > EGameplayEffectStackingType::None;
+	Summary.StackLimitCount = Definition->StackLimitCount;
+	Summary.StackDurationRefreshPolicy = StaticEnum<EGameplayEffectStackingDurationPolicy>()->GetNameStringByValue((int64)Definition->StackDurationRefreshPolicy);
+	Summary.StackExpirationPolicy = StaticEnum<EGameplayEffectStackingExpirationPolicy>()->GetNameStringByValue((int64)Definition->StackExpirationPolicy);
+	Summary.StackPeriodResetPolicy = StaticEnum<EGameplayEffectStackingPeriodPolicy>()->GetNameStringByValue((int64)Definition->StackPeriodResetPolicy);
+	Summary.GrantedTags = Definition->GetGrantedTags().ToStringSimple();
+	Summary.AssetTags = Definition->GetAssetTags().ToStringSimple();
+
+	return Summary;
+}
+
+void FKaosAbilitySystemDebugCache::Invalidate()
+{
+	AttributeSetMetadata.Reset();
+	EffectDefinitionSummaries.Reset();
+}
+
+void FKaosAbilitySystemDebugCache::BindEditorInvalidation()
+{
+#if WITH_EDITOR
+	// GEditor does not exist yet when the module starts, so bind on first use instead
+	if (!BlueprintCompiledHandle.IsValid() && GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FKaosAbilitySystemDebugCache::Invalidate);
+	}
+#endif
+}
+
+void FKaosAbilitySystemDebugCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	Invalidate();
+}
+#endif
@@ -0,0 +1,109 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosAbilitySystemWorldBinder.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "UObject/UObjectHash.h"
+
+void KaosAbilitySystem::ForEachComponent(TFunctionRef<void(UAbilitySystemComponent* AbilityComp)> Callback)
+{
+	ForEachObjectOfClass(UAbilitySystemComponent::StaticClass(), [&Callback](UObject* Object)
+	{
+		Callback(CastChecked<UAbilitySystemComponent>(Object));
+	}, true, RF_ClassDefaultObject, EInternalObjectFlags::Garbage);
+}
+
+void KaosAbilitySystem::GetComponentsInWorld(const UWorld* World, TArray<UAbilitySystemComponent*>& OutComponents)
+{
+	OutComponents.Reset();
+	ForEachComponent([World, &OutComponents](UAbilitySystemComponent* AbilityComp)
+	{
+		if (AbilityComp->GetWorld() == World)
+		{
+			OutComponents.Add(AbilityComp);
+		}
+	});
+}
+
+FKaosAbilitySystemWorldBinder::~FKaosAbilitySystemWorldBinder()
+{
+	// Owners unbind explicitly, by now their callbacks may point at destroyed members
+	OnUnbind.Unbind();
+	UnbindAll();
+}
+
+void FKaosAbilitySystemWorldBinder::Tick(UWorld* World, float DeltaTime)
+{
+	if (BoundWorld != World)
+	{
+		UnbindAll();
+		BoundWorld = World;
+	}
+
+	if (!World)
+	{
+		return;
+	}
+
+	TimeSinceLastScan += DeltaTime;
+	if (TimeSinceLastScan < ScanInterval)
+	{
+		return;
+	}
+	TimeSinceLastScan = 0;
+
+	for (auto It = BoundComponents.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<UAbilitySystemComponent*> Components;
+	KaosAbilitySystem::GetComponentsInWorld(World, Components);
+	for (UAbilitySystemComponent* AbilityComp : Components)
+	{
+		bool bAlreadyBound = false;
+		BoundComponents.Add(AbilityComp, &bAlreadyBound);
+		if (!bAlreadyBound)
+		{
+			OnBind.ExecuteIfBound(AbilityComp);
+		}
+	}
+}
+
+void FKaosAbilitySystemWorldBinder::UnbindAll()
+{
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakComp : BoundComponents)
+	{
+		if (UAbilitySystemComponent* AbilityComp = WeakComp.Get())
+		{
+			OnUnbind.ExecuteIfBound(AbilityComp);
+		}
+	}
+
+	BoundWorld.Reset();
+	BoundComponents.Reset();
+	TimeSinceLastScan = TNumericLimits<double>::Max();
+}
+#endif
@@ -0,0 +1,257 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosAttributeHistoryRecorder.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+
+FKaosAttributeHistoryRecorder::~FKaosAttributeHistoryRecorder()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+void FKaosAttributeHistoryRecorder::Pin(UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute)
+{
+	if (!AbilityComp || !Attribute.IsValid() || IsPinned(AbilityComp, Attribute))
+	{
+		return;
+	}
+
+	FKaosPinnedAttribute& Pinned = PinnedAttributes.AddDefaulted_GetRef();
+	Pinned.AbilitySystem = AbilityComp;
+	Pinned.Attribute = Attribute;
+	Pinned.OwnerName = GetNameSafe(AbilityComp->GetOwnerActor());
+	Pinned.AttributeName = Attribute.AttributeName;
+	Pinned.Samples.SetCapacity(GetSamplesPerAttribute());
+	Pinned.Samples.Push({ FPlatformTime::Seconds(), static_cast<float>(AbilityComp->GetNumericAttribute(Attribute)) });
+
+	UpdateTicker();
+}
+
+void FKaosAttributeHistoryRecorder::Unpin(const UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute)
+{
+	PinnedAttributes.RemoveAll([AbilityComp, &Attribute](const FKaosPinnedAttribute& Pinned)
+	{
+		return Pinned.AbilitySystem == AbilityComp && Pinned.Attribute == Attribute;
+	});
+	UpdateTicker();
+}
+
+void FKaosAttributeHistoryRecorder::UnpinAt(int32 Index)
+{
+	if (PinnedAttributes.IsValidIndex(Index))
+	{
+		PinnedAttributes.RemoveAt(Index);
+		UpdateTicker();
+	}
+}
+
+void FKaosAttributeHistoryRecorder::UnpinAll()
+{
+	PinnedAttributes.Reset();
+	UpdateTicker();
+}
+
+bool FKaosAttributeHistoryRecorder::IsPinned(const UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute) const
+{
+	return PinnedAttributes.ContainsByPredicate([AbilityComp, &Attribute](const FKaosPinnedAttribute& Pinned)
+	{
+		return Pinned.AbilitySystem == AbilityComp && Pinned.Attribute == Attribute;
+	});
+}
+
+void FKaosAttributeHistoryRecorder::SetSampleRate(float InSampleRate)
+{
+	InSampleRate = FMath::Clamp(InSampleRate, 0.1f, 120.f);
+	if (InSampleRate == SampleRate)
+	{
+		return;
+	}
+	SampleRate = InSampleRate;
+	ResizeBuffers();
+
+	// The ticker interval is fixed when it is added, so it has to be re-added at the new rate
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	UpdateTicker();
+}
+
+void FKaosAttributeHistoryRecorder::SetHistorySeconds(float InHistorySeconds)
+{
+	InHistorySeconds = FMath::Clamp(InHistorySeconds, 1.f, 3600.f);
+	if (InHistorySeconds == HistorySeconds)
+	{
+		return;
+	}
+	HistorySeconds = InHistorySeconds;
+	ResizeBuffers();
+}
+
+int32 FKaosAttributeHistoryRecorder::GetSamplesPerAttribute() const
+{
+	return FMath::Clamp(FMath::CeilToInt32(SampleRate * HistorySeconds), 1, MaxSamplesPerAttribute);
+}
+
+SIZE_T FKaosAttributeHistoryRecorder::GetAllocatedSize(const FKaosPinnedAttribute& Pinned) const
+{
+	return sizeof(FKaosPinnedAttribute) + Pinned.Samples.GetAllocatedSize() + Pinned.PlotPoints.GetAllocatedSize() + Pinned.OwnerName.GetAllocatedSize() + Pinned.AttributeName.GetAllocatedSize();
+}
+
+SIZE_T FKaosAttributeHistoryRecorder::GetAllocatedSize() const
+{
+	SIZE_T Total = PinnedAttributes.GetAllocatedSize();
+	for (const FKaosPinnedAttribute& Pinned : PinnedAttributes)
+	{
+		Total += GetAllocatedSize(Pinned) - sizeof(FKaosPinnedAttribute);
+	}
+	return Total;
+}
+
+const TArray<FVector2D>& FKaosAttributeHistoryRecorder::GetPlotPoints(FKaosPinnedAttribute& Pinned, double WindowSeconds, int32 NumBuckets) const
+{
+	if (Pinned.PlotSampleStamp != Pinned.Samples.GetTotalPushed() || Pinned.PlotWindowSeconds != WindowSeconds)
+	{
+		Pinned.PlotSampleStamp = Pinned.Samples.GetTotalPushed();
+		Pinned.PlotWindowSeconds = WindowSeconds;
+
+		const double EndTime = Pinned.Samples.IsEmpty() ? 0.0 : Pinned.Samples.Last().Time;
+		Decimate(Pinned.Samples, EndTime - WindowSeconds, EndTime, NumBuckets, Pinned.PlotPoints);
+	}
+	return Pinned.PlotPoints;
+}
+
+void FKaosAttributeHistoryRecorder::Decimate(const TKaosRingBuffer<FKaosAttributeSample>& Samples, double StartTime, double EndTime, int32 NumBuckets, TArray<FVector2D>& OutPoints)
+{
+	OutPoints.Reset(NumBuckets * 2);
+	if (Samples.IsEmpty() || NumBuckets <= 0 || EndTime <= StartTime)
+	{
+		return;
+	}
+
+	// Samples are pushed in time order, so the start of the window can be found with a binary search
+	int32 First = 0;
+	int32 Last = Samples.Num();
+	while (First < Last)
+	{
+		const int32 Mid = First + (Last - First) / 2;
+		if (Samples[Mid].Time < StartTime)
+		{
+			First = Mid + 1;
+		}
+		else
+		{
+			Last = Mid;
+		}
+	}
+
+	// Keep the min and max of every bucket, in the order they happened, so spikes survive any zoom level
+	const double BucketWidth = (EndTime - StartTime) / NumBuckets;
+	int32 CurrentBucket = INDEX_NONE;
+	int32 MinIndex = INDEX_NONE;
+	int32 MaxIndex = INDEX_NONE;
+
+	auto FlushBucket = [&]()
+	{
+		if (MinIndex == INDEX_NONE)
+		{
+			return;
+		}
+		const int32 EarlierIndex = FMath::Min(MinIndex, MaxIndex);
+		const int32 LaterIndex = FMath::Max(MinIndex, MaxIndex);
+		OutPoints.Emplace(Samples[EarlierIndex].Time - EndTime, Samples[EarlierIndex].Value);
+		if (LaterIndex != EarlierIndex)
+		{
+			OutPoints.Emplace(Samples[LaterIndex].Time - EndTime, Samples[LaterIndex].Value);
+		}
+	};
+
+	for (int32 Index = First; Index < Samples.Num(); ++Index)
+	{
+		const FKaosAttributeSample& Sample = Samples[Index];
+		const int32 Bucket = FMath::Min(static_cast<int32>((Sample.Time - StartTime) / BucketWidth), NumBuckets - 1);
+		if (Bucket != CurrentBucket)
+		{
+			FlushBucket();
+			CurrentBucket = Bucket;
+			MinIndex = Index;
+			MaxIndex = Index;
+			continue;
+		}
+
+		if (Sample.Value < Samples[MinIndex].Value)
+		{
+			MinIndex = Index;
+		}
+		if (Sample.Value > Samples[MaxIndex].Value)
+		{
+			MaxIndex = Index;
+		}
+	}
+	FlushBucket();
+}
+
+bool FKaosAttributeHistoryRecorder::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	for (FKaosPinnedAttribute& Pinned : PinnedAttributes)
+	{
+		// History is kept once the owner goes away, it just stops growing
+		if (const UAbilitySystemComponent* AbilityComp = Pinned.AbilitySystem.Get())
+		{
+			Pinned.Samples.Push({ Now, static_cast<float>(AbilityComp->GetNumericAttribute(Pinned.Attribute)) });
+		}
+	}
+	return true;
+}
+
+void FKaosAttributeHistoryRecorder::UpdateTicker()
+{
+	if (PinnedAttributes.IsEmpty())
+	{
+		if (TickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+			TickerHandle.Reset();
+		}
+	}
+	else if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FKaosAttributeHistoryRecorder::Tick), 1.f / SampleRate);
+	}
+}
+
+void FKaosAttributeHistoryRecorder::ResizeBuffers()
+{
+	// Samples taken at the old rate would be spaced differently to new ones, so start over
+	const int32 Capacity = GetSamplesPerAttribute();
+	for (FKaosPinnedAttribute& Pinned : PinnedAttributes)
+	{
+		Pinned.Samples.SetCapacity(Capacity);
+		Pinned.PlotPoints.Empty();
+		Pinned.PlotSampleStamp = MAX_uint64;
+	}
+}
+#endif
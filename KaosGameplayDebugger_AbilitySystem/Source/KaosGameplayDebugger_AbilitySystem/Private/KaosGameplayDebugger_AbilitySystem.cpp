@@ -20,11 +20,26 @@
 
 #include "KaosGameplayDebugger_AbilitySystem.h"
 
+#include "AbilitySystemComponent.h"
+#include "KaosAbilitySystemWorldBinder.h"
 #include "KaosGameplayDebuggerModule.h"
+#include "KaosWorldDebugger_AbilityFailures.h"
+#include "KaosWorldDebugger_AbilityLatency.h"
+#include "KaosWorldDebugger_AbilitySystemStats.h"
 #include "KaosWorldDebugger_ActorSubTab_AbilitySystem.h"
+#include "KaosWorldDebugger_AttributeHistory.h"
+#include "KaosWorldDebugger_AttributeLeaderboard.h"
+#include "KaosWorldDebugger_AttributeSetMemory.h"
+#include "KaosWorldDebugger_EffectRates.h"
 #include "KaosWorldDebugger_GameplayAbilities.h"
 #include "KaosWorldDebugger_GameplayAttributes.h"
 #include "KaosWorldDebugger_GameplayEffect.h"
+#include "KaosWorldDebugger_GameplayEffectCensus.h"
+#include "KaosWorldDebugger_GameplayEffectTimeline.h"
+#include "KaosWorldDebugger_OwnedTags.h"
+#include "KaosWorldDebugger_PredictionTracker.h"
+#include "KaosWorldDebugger_ReplicationFootprint.h"
+#include "KaosWorldDebugger_TagQuery.h"
 
 #define LOCTEXT_NAMESPACE "FKaosGameplayDebugger_AbilitySystemModule"
 
@@ -35,9 +50,24 @@ void FKaosGameplayDebugger_AbilitySystemModule::StartupModule()
 	FKaosGameplayDebuggerModule& Module = FKaosGameplayDebuggerModule::Get();
 
 	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::Actor, "Abilities", MakeShared<FKaosWorldDebugger_ActorSubTab_AbilitySystem>(), 3));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::World, "Gameplay Effect Census", MakeShared<FKaosWorldDebugger_GameplayEffectCensus>(), 1001));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::World, "Attribute Leaderboard", MakeShared<FKaosWorldDebugger_AttributeLeaderboard>(), 1002));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::World, "Tag Query", MakeShared<FKaosWorldDebugger_TagQuery>(), 1003));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::World, "Effect Rates", MakeShared<FKaosWorldDebugger_EffectRates>(), 1004));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::World, "Ability Failures", MakeShared<FKaosWorldDebugger_AbilityFailures>(), 1005));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebuggerMainTabAreas::World, "Attribute Set Memory", MakeShared<FKaosWorldDebugger_AttributeSetMemory>(), 1006));
 	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "GameplayEffects", MakeShared<FKaosWorldDebugger_GameplayEffects>(), 0));
 	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "Ability", MakeShared<FKaosWorldDebugger_GameplayAbilities>(), 1));
 	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "Attributes", MakeShared<FKaosWorldDebugger_GameplayAttributes>(), 2));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "AttributeHistory", MakeShared<FKaosWorldDebugger_AttributeHistory>(), 3));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "EffectTimeline", MakeShared<FKaosWorldDebugger_GameplayEffectTimeline>(), 4));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "AbilityLatency", MakeShared<FKaosWorldDebugger_AbilityLatency>(), 5));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "OwnedTags", MakeShared<FKaosWorldDebugger_OwnedTags>(), 6));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "Prediction", MakeShared<FKaosWorldDebugger_PredictionTracker>(), 7));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "Replication", MakeShared<FKaosWorldDebugger_ReplicationFootprint>(), 8));
+	RegisteredSubCategories.Add(Module.RegisterSubCategory(KaosDebugger_AbilitySystemNames::AbilitySystemMainTabID, "Stats", MakeShared<FKaosWorldDebugger_AbilitySystemStats>(), 9));
+
+	CollectWorldStatsHandle = Module.OnCollectWorldStats().AddRaw(this, &FKaosGameplayDebugger_AbilitySystemModule::CollectWorldStats);
 #endif
 }
 
@@ -49,9 +79,34 @@ void FKaosGameplayDebugger_AbilitySystemModule::ShutdownModule()
 	{
 		Module.UnregisterSubCategory(Handle);
 	}
+	Module.OnCollectWorldStats().Remove(CollectWorldStatsHandle);
+	AttributeHistory.UnpinAll();
 #endif
 }
 
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+void FKaosGameplayDebugger_AbilitySystemModule::CollectWorldStats(UWorld* World, TArray<FKaosDebugLine>& OutLines)
+{
+	// The matrix asks once per world, bucket every component in a single pass and serve the rest of the frame from that
+	if (WorldStatsFrame != GFrameCounter)
+	{
+		WorldStatsFrame = GFrameCounter;
+		WorldStats.Reset();
+
+		KaosAbilitySystem::ForEachComponent([this](UAbilitySystemComponent* AbilityComp)
+		{
+			FKaosWorldAbilityStats& Stats = WorldStats.FindOrAdd(AbilityComp->GetWorld());
+			++Stats.NumComponents;
+			Stats.NumActiveEffects += AbilityComp->GetActiveGameplayEffects().GetNumGameplayEffects();
+		});
+	}
+
+	const FKaosWorldAbilityStats* Stats = WorldStats.Find(World);
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Ability System Components"), FString::FromInt(Stats ? Stats->NumComponents : 0)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Active Gameplay Effects"), FString::FromInt(Stats ? Stats->NumActiveEffects : 0)));
+}
+#endif
+
 #undef LOCTEXT_NAMESPACE
 	
 IMPLEMENT_MODULE(FKaosGameplayDebugger_AbilitySystemModule, KaosGameplayDebugger_AbilitySystem)
\ No newline at end of file
@@ -0,0 +1,391 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosGameplayEffectStressTest.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "GameplayEffect.h"
+#include "GameplayTagsManager.h"
+#include "KaosAbilitySystemWorldBinder.h"
+#include "KaosSlateIMHelpers.h"
+#include "UObject/UObjectIterator.h"
+
+FKaosGameplayEffectStressTest::~FKaosGameplayEffectStressTest()
+{
+	Stop();
+}
+
+void FKaosGameplayEffectStressTest::Draw(UWorld* World, UAbilitySystemComponent* SelectedASC)
+{
+	if (EffectClasses.IsEmpty())
+	{
+		RefreshEffectClasses();
+	}
+
+	SlateIM::BeginVerticalStack();
+	KaosSlateIM::SubHeaderText(TEXT("Stress Test"));
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Effect:"));
+	SlateIM::MinWidth(260.f);
+	SlateIM::ComboBox(EffectClassNames, SelectedEffectIndex, bForceEffectComboRefresh);
+	bForceEffectComboRefresh = false;
+	if (SlateIM::Button(TEXT("Refresh Classes")))
+	{
+		RefreshEffectClasses();
+	}
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Level:"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(Level, 1.f, 100.f);
+	SlateIM::EndHorizontalStack();
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Set By Caller:"));
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::EditableText(SetByCallerText, TEXT("Data.Damage=10, Data.Duration=5"));
+	SlateIM::EndHorizontalStack();
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::CheckBox(TEXT("All Owners Matching"), bAllMatchingOwners);
+	SlateIM::MinWidth(160.f);
+	SlateIM::EditableText(OwnerClassFilter, TEXT("Owner class filter"));
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Per Frame:"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(ApplicationsPerFrame, 1, 1000);
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Frames:"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(NumFrames, 1, 600);
+	SlateIM::Spacer(FVector2D(12, 0));
+	if (IsRunning())
+	{
+		if (SlateIM::Button(TEXT("Stop")))
+		{
+			Stop();
+		}
+	}
+	else
+	{
+		if (SlateIM::Button(TEXT("Run")))
+		{
+			Start(World, SelectedASC);
+		}
+		if (NumAppliedHandles > 0 && SlateIM::Button(FString::Printf(TEXT("Remove %d Applied Effects"), NumAppliedHandles)))
+		{
+			RemoveAppliedEffects();
+		}
+	}
+	SlateIM::EndHorizontalStack();
+
+	if (!SelectedASC && !bAllMatchingOwners)
+	{
+		KaosSlateIM::WarningText(TEXT("Select an actor with an Ability System Component, or target all matching owners."));
+	}
+
+	DrawResults();
+	SlateIM::EndVerticalStack();
+}
+
+void FKaosGameplayEffectStressTest::RefreshEffectClasses()
+{
+	const TWeakObjectPtr<UClass> PreviousSelection = EffectClasses.IsValidIndex(SelectedEffectIndex) ? EffectClasses[SelectedEffectIndex] : nullptr;
+
+	// Only classes already in memory, loading every effect asset to fill a combo box would be its own stress test
+	EffectClasses.Reset();
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (Class->IsChildOf(UGameplayEffect::StaticClass())
+			&& !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)
+			&& !Class->GetName().StartsWith(TEXT("SKEL_")))
+		{
+			EffectClasses.Add(Class);
+		}
+	}
+
+	EffectClasses.Sort([](const TWeakObjectPtr<UClass>& A, const TWeakObjectPtr<UClass>& B)
+	{
+		return GetNameSafe(A.Get()) < GetNameSafe(B.Get());
+	});
+	EffectClassNames.Reset(EffectClasses.Num());
+	for (const TWeakObjectPtr<UClass>& Class : EffectClasses)
+	{
+		EffectClassNames.Add(GetNameSafe(Class.Get()));
+	}
+
+	SelectedEffectIndex = FMath::Max(EffectClasses.IndexOfByKey(PreviousSelection), 0);
+	bForceEffectComboRefresh = true;
+}
+
+void FKaosGameplayEffectStressTest::Start(UWorld* World, UAbilitySystemComponent* SelectedASC)
+{
+	Stop();
+
+	RunEffectClass = EffectClasses.IsValidIndex(SelectedEffectIndex) ? EffectClasses[SelectedEffectIndex] : nullptr;
+	if (!RunEffectClass.IsValid())
+	{
+		return;
+	}
+
+	RunLevel = Level;
+	RunSetByCallers.Reset();
+	SetByCallerErrors.Reset();
+	TArray<FString> Entries;
+	SetByCallerText.ParseIntoArray(Entries, TEXT(","));
+	for (const FString& Entry : Entries)
+	{
+		FString TagName;
+		FString Value;
+		const FGameplayTag Tag = Entry.Split(TEXT("="), &TagName, &Value) ? UGameplayTagsManager::Get().RequestGameplayTag(FName(*TagName.TrimStartAndEnd()), false) : FGameplayTag();
+		if (Tag.IsValid() && Value.TrimStartAndEnd().IsNumeric())
+		{
+			RunSetByCallers.Add(Tag, FCString::Atof(*Value.TrimStartAndEnd()));
+		}
+		else if (!Entry.TrimStartAndEnd().IsEmpty())
+		{
+			SetByCallerErrors.Add(Entry.TrimStartAndEnd());
+		}
+	}
+
+	RunTargets.Reset();
+	SkippedTargets = 0;
+	auto AddTarget = [this](UAbilitySystemComponent* AbilityComp)
+	{
+		// Clients would only predict, which needs a prediction window this ticker does not have
+		if (AbilityComp->IsOwnerActorAuthoritative())
+		{
+			RunTargets.Add(AbilityComp);
+		}
+		else
+		{
+			++SkippedTargets;
+		}
+	};
+
+	if (bAllMatchingOwners && World)
+	{
+		TArray<UAbilitySystemComponent*> Components;
+		KaosAbilitySystem::GetComponentsInWorld(World, Components);
+		for (UAbilitySystemComponent* AbilityComp : Components)
+		{
+			const AActor* Owner = AbilityComp->GetOwnerActor();
+			if (Owner && (OwnerClassFilter.IsEmpty() || Owner->GetClass()->GetName().Contains(OwnerClassFilter)))
+			{
+				AddTarget(AbilityComp);
+			}
+		}
+	}
+	else if (SelectedASC)
+	{
+		AddTarget(SelectedASC);
+	}
+
+	Applications = 0;
+	BaselineFrameTime = 0.0;
+	RunFrameTime = 0.0;
+	MaxRunFrameTime = 0.0;
+	ApplyTime = 0.0;
+	SampledBaselineFrames = 0;
+	SampledRunFrames = 0;
+	bStoppedEarly = false;
+	if (RunTargets.IsEmpty())
+	{
+		return;
+	}
+
+	PreexistingHandles.Reset();
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakComp : RunTargets)
+	{
+		if (const UAbilitySystemComponent* AbilityComp = WeakComp.Get())
+		{
+			for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+			{
+				PreexistingHandles.Add(ActiveGE.Handle);
+			}
+		}
+	}
+
+	Phase = EPhase::Baseline;
+	FramesRemaining = NumFrames;
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FKaosGameplayEffectStressTest::Tick));
+}
+
+void FKaosGameplayEffectStressTest::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// The frame times are still running sums, turn them into the averages the results show
+	if (Phase == EPhase::Baseline)
+	{
+		// Nothing was applied yet, so there is no run to compare against
+		SampledRunFrames = 0;
+	}
+	else if (Phase == EPhase::Applying)
+	{
+		RunFrameTime /= FMath::Max(SampledRunFrames, 1);
+		bStoppedEarly = true;
+	}
+	Phase = EPhase::Idle;
+}
+
+bool FKaosGameplayEffectStressTest::Tick(float DeltaTime)
+{
+	// DeltaTime covers the frame that just finished, so the first applying tick still measures a baseline frame
+	if (Phase == EPhase::Baseline)
+	{
+		if (SampledBaselineFrames > 0)
+		{
+			BaselineFrameTime += DeltaTime;
+		}
+		if (++SampledBaselineFrames > BaselineFrames)
+		{
+			BaselineFrameTime /= BaselineFrames;
+			Phase = EPhase::Applying;
+			ApplyFrame();
+		}
+		return true;
+	}
+
+	RunFrameTime += DeltaTime;
+	MaxRunFrameTime = FMath::Max<double>(MaxRunFrameTime, DeltaTime);
+	++SampledRunFrames;
+
+	if (FramesRemaining > 0)
+	{
+		ApplyFrame();
+		return true;
+	}
+
+	RunFrameTime /= FMath::Max(SampledRunFrames, 1);
+	TickerHandle.Reset();
+	Phase = EPhase::Idle;
+	return false;
+}
+
+void FKaosGameplayEffectStressTest::ApplyFrame()
+{
+	--FramesRemaining;
+
+	const UGameplayEffect* Effect = RunEffectClass.IsValid() ? GetDefault<UGameplayEffect>(RunEffectClass.Get()) : nullptr;
+	if (!Effect)
+	{
+		FramesRemaining = 0;
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakComp : RunTargets)
+	{
+		UAbilitySystemComponent* AbilityComp = WeakComp.Get();
+		if (!AbilityComp)
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; Index < ApplicationsPerFrame; ++Index)
+		{
+			FGameplayEffectSpec Spec(Effect, AbilityComp->MakeEffectContext(), RunLevel);
+			for (const TPair<FGameplayTag, float>& SetByCaller : RunSetByCallers)
+			{
+				Spec.SetSetByCallerMagnitude(SetByCaller.Key, SetByCaller.Value);
+			}
+
+			// Instant effects come back with an invalid handle, only ones that stay active need removing later
+			const FActiveGameplayEffectHandle Handle = AbilityComp->ApplyGameplayEffectSpecToSelf(Spec);
+			if (Handle.IsValid() && !PreexistingHandles.Contains(Handle))
+			{
+				bool bAlreadyApplied = false;
+				AppliedHandles.FindOrAdd(WeakComp).Add(Handle, &bAlreadyApplied);
+				NumAppliedHandles += bAlreadyApplied ? 0 : 1;
+			}
+			++Applications;
+		}
+	}
+	ApplyTime += FPlatformTime::Seconds() - StartTime;
+}
+
+void FKaosGameplayEffectStressTest::RemoveAppliedEffects()
+{
+	// Handles that already expired or were removed elsewhere are simply not found
+	for (const TPair<TWeakObjectPtr<UAbilitySystemComponent>, TSet<FActiveGameplayEffectHandle>>& Pair : AppliedHandles)
+	{
+		if (UAbilitySystemComponent* AbilityComp = Pair.Key.Get())
+		{
+			for (const FActiveGameplayEffectHandle& Handle : Pair.Value)
+			{
+				AbilityComp->RemoveActiveGameplayEffect(Handle);
+			}
+		}
+	}
+	AppliedHandles.Reset();
+	NumAppliedHandles = 0;
+}
+
+void FKaosGameplayEffectStressTest::DrawResults() const
+{
+	if (!SetByCallerErrors.IsEmpty())
+	{
+		KaosSlateIM::WarningText(FString::Printf(TEXT("Ignored Set By Caller entries: %s"), *FString::Join(SetByCallerErrors, TEXT(", "))));
+	}
+	if (SkippedTargets > 0)
+	{
+		KaosSlateIM::WarningText(FString::Printf(TEXT("Skipped %d targets without authority."), SkippedTargets));
+	}
+
+	if (Phase == EPhase::Baseline)
+	{
+		SlateIM::Text(FString::Printf(TEXT("Measuring baseline %d / %d frames..."), SampledBaselineFrames, BaselineFrames));
+		return;
+	}
+	if (Phase == EPhase::Applying)
+	{
+		SlateIM::Text(FString::Printf(TEXT("Applying to %d targets, %d frames left..."), RunTargets.Num(), FramesRemaining));
+		return;
+	}
+	if (SampledRunFrames == 0)
+	{
+		return;
+	}
+	if (bStoppedEarly)
+	{
+		KaosSlateIM::WarningText(FString::Printf(TEXT("Stopped early, the run averages cover %d frames."), SampledRunFrames));
+	}
+
+	KaosSlateIM::DrawLabledText(TEXT("Targets / Applications"), FString::Printf(TEXT("%d / %d"), RunTargets.Num(), Applications));
+	KaosSlateIM::DrawLabledText(TEXT("Baseline Frame"), FString::Printf(TEXT("%.2f ms"), BaselineFrameTime * 1000.0));
+	KaosSlateIM::DrawLabledText(TEXT("Run Frame (avg / max)"), FString::Printf(TEXT("%.2f / %.2f ms"), RunFrameTime * 1000.0, MaxRunFrameTime * 1000.0));
+	KaosSlateIM::DrawLabledText(TEXT("Frame Time Delta"), FString::Printf(TEXT("%+.2f ms"), (RunFrameTime - BaselineFrameTime) * 1000.0),
+		RunFrameTime > BaselineFrameTime * 1.1 ? FLinearColor::Yellow : FLinearColor::White);
+	KaosSlateIM::DrawLabledText(TEXT("Apply Cost"), FString::Printf(TEXT("%.2f ms total, %.1f us per application"), ApplyTime * 1000.0, Applications > 0 ? ApplyTime * 1e6 / Applications : 0.0));
+}
+#endif
@@ -0,0 +1,98 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosPredictionKeyTracker.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Abilities/GameplayAbility.h"
+
+FKaosPredictionKeyTracker::FKaosPredictionKeyTracker()
+{
+	Listener.OnCaughtUp.BindLambda([this](FPredictionKey::KeyType Key) { ResolveKey(Key, OnCaughtUp); });
+	Listener.OnRejected.BindLambda([this](FPredictionKey::KeyType Key) { ResolveKey(Key, OnRejected); });
+}
+
+FKaosInFlightPredictionKey* FKaosPredictionKeyTracker::Track(FPredictionKey PredictionKey, const UGameplayAbility* Ability, bool& bOutAdded)
+{
+	bOutAdded = false;
+
+	// Only the predicting client can hear back about its own key
+	if (!PredictionKey.IsLocalClientKey() || ResolvedKeys.Contains(PredictionKey.Current))
+	{
+		return nullptr;
+	}
+
+	if (FKaosInFlightPredictionKey* Existing = InFlightKeys.Find(PredictionKey.Current))
+	{
+		return Existing;
+	}
+
+	if (InFlightKeys.Num() >= MaxInFlightKeys)
+	{
+		++DroppedKeys;
+		return nullptr;
+	}
+
+	FKaosInFlightPredictionKey& InFlight = InFlightKeys.Add(PredictionKey.Current);
+	InFlight.AbilityClass = Ability ? Ability->GetClass() : nullptr;
+	InFlight.IssuedTime = FPlatformTime::Seconds();
+	bOutAdded = true;
+
+	Listener.Listen(PredictionKey);
+	return &InFlight;
+}
+
+void FKaosPredictionKeyTracker::Reset()
+{
+	Listener.Reset();
+	InFlightKeys.Reset();
+	ResolvedKeys.Reset();
+	ResolvedOrder.Reset();
+	DroppedKeys = 0;
+}
+
+double FKaosPredictionKeyTracker::GetOldestAge() const
+{
+	double OldestIssuedTime = FPlatformTime::Seconds();
+	for (const auto& Pair : InFlightKeys)
+	{
+		OldestIssuedTime = FMath::Min(OldestIssuedTime, Pair.Value.IssuedTime);
+	}
+	return FPlatformTime::Seconds() - OldestIssuedTime;
+}
+
+void FKaosPredictionKeyTracker::ResolveKey(FPredictionKey::KeyType Key, const FOnKeyResolved& Callback)
+{
+	// A rejected key is caught up afterwards as well, removing it here turns that second callback into a no-op
+	FKaosInFlightPredictionKey InFlight;
+	if (!InFlightKeys.RemoveAndCopyValue(Key, InFlight))
+	{
+		return;
+	}
+
+	if (ResolvedOrder.IsFull())
+	{
+		ResolvedKeys.Remove(ResolvedOrder[0]);
+	}
+	ResolvedOrder.Push(Key);
+	ResolvedKeys.Add(Key);
+
+	Callback.ExecuteIfBound(Key, InFlight);
+}
+#endif
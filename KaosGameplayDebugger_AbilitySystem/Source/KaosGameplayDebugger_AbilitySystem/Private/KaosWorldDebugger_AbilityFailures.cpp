@@ -0,0 +1,201 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_AbilityFailures.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "Engine/World.h"
+#include "KaosGameplayDebuggerModule.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_AbilityFailures::FKaosWorldDebugger_AbilityFailures()
+{
+	Binder.OnBind.BindRaw(this, &FKaosWorldDebugger_AbilityFailures::BindAbilitySystem);
+	Binder.OnUnbind.BindRaw(this, &FKaosWorldDebugger_AbilityFailures::UnbindAbilitySystem);
+}
+
+FKaosWorldDebugger_AbilityFailures::~FKaosWorldDebugger_AbilityFailures()
+{
+	Binder.UnbindAll();
+}
+
+void FKaosWorldDebugger_AbilityFailures::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::CheckBox(TEXT("Record"), bRecording);
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Rate Window (s):"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(RateWindow, 0.25f, 10.f);
+	SlateIM::Spacer(FVector2D(12, 0));
+	if (SlateIM::Button(TEXT("Reset")))
+	{
+		Counters.Reset();
+	}
+	SlateIM::EndHorizontalStack();
+
+	TickRecording(World, Context.DeltaTime);
+
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(Binder.Num()));
+	KaosSlateIM::DrawLabledText(TEXT("Failures"), FString::Printf(TEXT("%u"), Counters.GetTotalCount()));
+
+	if (Counters.GetSortedIndices().IsEmpty())
+	{
+		KaosSlateIM::WarningText(TEXT("No ability activation failures since recording started."));
+		return;
+	}
+
+	const double PlatformNow = FPlatformTime::Seconds();
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Ability"));
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Reason"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Count"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Rate/s"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Peak"));
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Last Failure"));
+
+	for (const int32 Index : Counters.GetSortedIndices())
+	{
+		const FFailureCounters::FRow& Row = Counters.GetRow(Index);
+		const UAbilitySystemComponent* LastComp = Row.Data.LastComponent.Get();
+
+		if (SlateIM::NextTableCell()) SlateIM::Text(Row.Data.AbilityName, Index == Counters.OverflowIndex ? FLinearColor::Yellow : FLinearColor::White);
+		if (SlateIM::NextTableCell()) SlateIM::Text(Row.Data.Reason);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%u"), Row.Counts[0]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1f"), Row.Rates[0]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1f"), Row.PeakRates[0]));
+		if (SlateIM::NextTableCell())
+		{
+			if (SlateIM::Button(FString::Printf(TEXT("%s, %.1fs ago"), LastComp ? *GetNameSafe(LastComp->GetOwnerActor()) : TEXT("(Gone)"), PlatformNow - Row.Data.LastFailureTime), &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")) && LastComp)
+			{
+				FKaosGameplayDebuggerModule::Get().SelectActor(LastComp->GetOwnerActor());
+			}
+		}
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_AbilityFailures::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		return;
+	}
+
+	// Streaming keeps recording alive while the tab is closed, which is how soak tests watch it
+	TickRecording(World, Context.DeltaTime);
+
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Ability System Components"), FString::FromInt(Binder.Num())));
+	for (int32 Index = 0; Index < Counters.Num(); ++Index)
+	{
+		const FFailureCounters::FRow& Row = Counters.GetRow(Index);
+		if (Row.Counts[0] > 0)
+		{
+			OutLines.Add(FKaosDebugLine::Pair(FString::Printf(TEXT("%s: %s"), *Row.Data.AbilityName, *Row.Data.Reason), FString::Printf(TEXT("%u (peak %.1f/s)"), Row.Counts[0], Row.PeakRates[0])));
+		}
+	}
+}
+
+void FKaosWorldDebugger_AbilityFailures::BindAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	AbilityComp->AbilityFailedCallbacks.AddRaw(this, &FKaosWorldDebugger_AbilityFailures::OnAbilityFailed, TWeakObjectPtr<UAbilitySystemComponent>(AbilityComp));
+}
+
+void FKaosWorldDebugger_AbilityFailures::UnbindAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	AbilityComp->AbilityFailedCallbacks.RemoveAll(this);
+}
+
+int32 FKaosWorldDebugger_AbilityFailures::FindCounterIndex(const UGameplayAbility* Ability, const FGameplayTag& Reason)
+{
+	UClass* AbilityClass = Ability ? Ability->GetClass() : nullptr;
+	return Counters.FindOrAddRow(FFailureKey(AbilityClass, Reason), [AbilityClass, &Reason](FKaosFailureRow& Row)
+	{
+		Row.AbilityName = GetNameSafe(AbilityClass);
+		Row.Reason = Reason.IsValid() ? Reason.ToString() : TEXT("(No Tags)");
+	});
+}
+
+void FKaosWorldDebugger_AbilityFailures::OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureTags, TWeakObjectPtr<UAbilitySystemComponent> AbilityComp)
+{
+	if (FailureTags.IsEmpty())
+	{
+		RecordFailure(FindCounterIndex(Ability, FGameplayTag()), AbilityComp);
+		return;
+	}
+
+	for (const FGameplayTag& Reason : FailureTags)
+	{
+		RecordFailure(FindCounterIndex(Ability, Reason), AbilityComp);
+	}
+}
+
+void FKaosWorldDebugger_AbilityFailures::RecordFailure(int32 Index, const TWeakObjectPtr<UAbilitySystemComponent>& AbilityComp)
+{
+	Counters.Count(Index);
+	FKaosFailureRow& Row = Counters.GetRow(Index).Data;
+	Row.LastFailureTime = FPlatformTime::Seconds();
+	Row.LastComponent = AbilityComp;
+}
+
+void FKaosWorldDebugger_AbilityFailures::TickRecording(UWorld* World, float DeltaTime)
+{
+	if (LastTickFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastTickFrame = GFrameCounter;
+
+	if (bRecording)
+	{
+		Binder.Tick(World, DeltaTime);
+	}
+	else
+	{
+		Binder.UnbindAll();
+	}
+
+	Counters.Tick(World->GetRealTimeSeconds(), RateWindow);
+}
+
+FSlateIcon FKaosWorldDebugger_AbilityFailures::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.ErrorWithColor");
+
+	return MyIcon;
+}
+#endif
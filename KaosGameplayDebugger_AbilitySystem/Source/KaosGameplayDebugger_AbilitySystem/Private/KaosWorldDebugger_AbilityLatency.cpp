@@ -0,0 +1,290 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_AbilityLatency.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Abilities/GameplayAbility.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_AbilityLatency::~FKaosWorldDebugger_AbilityLatency()
+{
+	UnbindFromAbilitySystem();
+}
+
+void FKaosWorldDebugger_AbilityLatency::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor))
+	{
+		if (BoundASC != ASC)
+		{
+			BindToAbilitySystem(ASC);
+		}
+
+		SlateIM::BeginHorizontalStack();
+		SlateIM::VAlign(VAlign_Center);
+		SlateIM::Text(FString::Printf(TEXT("Recording %s (%s)"), *GetNameSafe(ContextActor), ASC->IsOwnerActorAuthoritative() ? TEXT("Authority") : TEXT("Client")));
+		SlateIM::Spacer(FVector2D(12, 0));
+		if (SlateIM::Button(TEXT("Reset")))
+		{
+			LatencyStats.Reset();
+			SelectedAbilityClass.Reset();
+			PredictionTracker.Reset();
+		}
+		SlateIM::EndHorizontalStack();
+
+		if (PredictionTracker.GetDroppedKeys() > 0)
+		{
+			KaosSlateIM::DrawLabledText(TEXT("Dropped Predictions"), FString::FromInt(PredictionTracker.GetDroppedKeys()), FLinearColor::Yellow);
+		}
+
+		if (LatencyStats.IsEmpty())
+		{
+			KaosSlateIM::WarningText(TEXT("No abilities activated since recording started."));
+			return;
+		}
+
+		SlateIM::BeginHorizontalStack();
+		DrawLatencyTable();
+		SlateIM::Fill();
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::VAlign(VAlign_Fill);
+		DrawLatencyDetails();
+		SlateIM::EndHorizontalStack();
+	}
+	else
+	{
+		UnbindFromAbilitySystem();
+		if (ContextActor)
+		{
+			KaosSlateIM::WarningText(TEXT("No Ability System Component found."));
+		}
+		else
+		{
+			KaosSlateIM::ErrorText(TEXT("No Actor selected."));
+		}
+	}
+}
+
+void FKaosWorldDebugger_AbilityLatency::BindToAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	UnbindFromAbilitySystem();
+
+	BoundASC = AbilityComp;
+	ActivatedHandle = AbilityComp->AbilityActivatedCallbacks.AddRaw(this, &FKaosWorldDebugger_AbilityLatency::OnAbilityActivated);
+	CommittedHandle = AbilityComp->AbilityCommittedCallbacks.AddRaw(this, &FKaosWorldDebugger_AbilityLatency::OnAbilityCommitted);
+	EndedHandle = AbilityComp->OnAbilityEnded.AddRaw(this, &FKaosWorldDebugger_AbilityLatency::OnAbilityEnded);
+	FailedHandle = AbilityComp->AbilityFailedCallbacks.AddRaw(this, &FKaosWorldDebugger_AbilityLatency::OnAbilityFailed);
+	PredictionTracker.OnCaughtUp.BindRaw(this, &FKaosWorldDebugger_AbilityLatency::OnPredictionCaughtUp);
+	PredictionTracker.OnRejected.BindRaw(this, &FKaosWorldDebugger_AbilityLatency::OnPredictionRejected);
+}
+
+void FKaosWorldDebugger_AbilityLatency::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		AbilityComp->AbilityActivatedCallbacks.Remove(ActivatedHandle);
+		AbilityComp->AbilityCommittedCallbacks.Remove(CommittedHandle);
+		AbilityComp->OnAbilityEnded.Remove(EndedHandle);
+		AbilityComp->AbilityFailedCallbacks.Remove(FailedHandle);
+	}
+
+	// Keys predicted on the old ASC may still resolve, they must not land in the new one's stats
+	PredictionTracker.Reset();
+	BoundASC.Reset();
+	ActivatedHandle.Reset();
+	CommittedHandle.Reset();
+	EndedHandle.Reset();
+	FailedHandle.Reset();
+	LatencyStats.Reset();
+	InFlightActivations.Reset();
+	SelectedAbilityClass.Reset();
+}
+
+FKaosWorldDebugger_AbilityLatency::FKaosAbilityLatencyStats& FKaosWorldDebugger_AbilityLatency::FindOrAddStats(const UGameplayAbility* Ability)
+{
+	UClass* AbilityClass = Ability ? Ability->GetClass() : nullptr;
+	if (FKaosAbilityLatencyStats* Found = LatencyStats.Find(AbilityClass))
+	{
+		return *Found;
+	}
+
+	FKaosAbilityLatencyStats& Stats = LatencyStats.Add(AbilityClass);
+	Stats.AbilityName = GetNameSafe(AbilityClass);
+	Stats.AbilityName.RemoveFromEnd(TEXT("_C"));
+	return Stats;
+}
+
+void FKaosWorldDebugger_AbilityLatency::OnAbilityActivated(UGameplayAbility* Ability)
+{
+	if (!Ability)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	FKaosAbilityLatencyStats& Stats = FindOrAddStats(Ability);
+	++Stats.Activations;
+
+	FKaosInFlightActivation& InFlight = InFlightActivations.Add(FKaosActivationKey(Ability->GetCurrentAbilitySpecHandle(), Ability));
+	InFlight.AbilityClass = Ability->GetClass();
+	InFlight.ActivatedTime = Now;
+
+	const FGameplayAbilityActivationInfo& ActivationInfo = Ability->GetCurrentActivationInfo();
+	const FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+	if (ActivationInfo.ActivationMode == EGameplayAbilityActivationMode::Predicting && PredictionKey.IsLocalClientKey())
+	{
+		++Stats.Predicted;
+		bool bAdded = false;
+		PredictionTracker.Track(PredictionKey, Ability, bAdded);
+	}
+}
+
+void FKaosWorldDebugger_AbilityLatency::OnAbilityCommitted(UGameplayAbility* Ability)
+{
+	FKaosInFlightActivation* InFlight = Ability ? InFlightActivations.Find(FKaosActivationKey(Ability->GetCurrentAbilitySpecHandle(), Ability)) : nullptr;
+	if (!InFlight || InFlight->bCommitted)
+	{
+		return;
+	}
+
+	InFlight->bCommitted = true;
+	FKaosAbilityLatencyStats& Stats = FindOrAddStats(Ability);
+	++Stats.Commits;
+	Stats.ActivateToCommit.Add(FPlatformTime::Seconds() - InFlight->ActivatedTime);
+}
+
+void FKaosWorldDebugger_AbilityLatency::OnAbilityEnded(const FAbilityEndedData& EndedData)
+{
+	FKaosInFlightActivation InFlight;
+	if (!InFlightActivations.RemoveAndCopyValue(FKaosActivationKey(EndedData.AbilitySpecHandle, EndedData.AbilityThatEnded), InFlight))
+	{
+		return;
+	}
+
+	if (FKaosAbilityLatencyStats* Stats = LatencyStats.Find(InFlight.AbilityClass))
+	{
+		++Stats->Ends;
+		Stats->Cancels += EndedData.bWasCancelled ? 1 : 0;
+		Stats->ActivateToEnd.Add(FPlatformTime::Seconds() - InFlight.ActivatedTime);
+	}
+}
+
+void FKaosWorldDebugger_AbilityLatency::OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureTags)
+{
+	FKaosAbilityLatencyStats& Stats = FindOrAddStats(Ability);
+	++Stats.Failures;
+	++Stats.FailureReasons.FindOrAdd(FailureTags.IsEmpty() ? FString(TEXT("(No Tags)")) : FailureTags.ToStringSimple());
+}
+
+void FKaosWorldDebugger_AbilityLatency::OnPredictionCaughtUp(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight)
+{
+	if (FKaosAbilityLatencyStats* Stats = LatencyStats.Find(InFlight.AbilityClass))
+	{
+		++Stats->Confirmed;
+		Stats->PredictedToConfirmed.Add(FPlatformTime::Seconds() - InFlight.IssuedTime);
+	}
+}
+
+void FKaosWorldDebugger_AbilityLatency::OnPredictionRejected(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight)
+{
+	if (FKaosAbilityLatencyStats* Stats = LatencyStats.Find(InFlight.AbilityClass))
+	{
+		++Stats->Rejected;
+	}
+}
+
+void FKaosWorldDebugger_AbilityLatency::DrawLatencyTable()
+{
+	auto FormatMs = [](const FKaosLogHistogram& Histogram, double Percentile)
+	{
+		return Histogram.GetCount() > 0 ? FString::Printf(TEXT("%.1f"), Histogram.GetPercentile(Percentile) * 1000.0) : FString(TEXT("-"));
+	};
+
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Ability"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Activated"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Failed"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Commit p50 ms"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("End p50 ms"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Confirm p50 ms"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Rejected"));
+
+	for (const auto& Pair : LatencyStats)
+	{
+		const FKaosAbilityLatencyStats& Stats = Pair.Value;
+		if (SlateIM::NextTableCell() && SlateIM::Button(Stats.AbilityName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+		{
+			SelectedAbilityClass = Pair.Key;
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Stats.Activations));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Stats.Failures));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatMs(Stats.ActivateToCommit, 0.5));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatMs(Stats.ActivateToEnd, 0.5));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatMs(Stats.PredictedToConfirmed, 0.5));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Stats.Rejected));
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_AbilityLatency::DrawLatencyDetails()
+{
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+	const FKaosAbilityLatencyStats* Sel = SelectedAbilityClass.IsSet() ? LatencyStats.Find(SelectedAbilityClass.GetValue()) : nullptr;
+	if (Sel)
+	{
+		KaosSlateIM::HeaderText(Sel->AbilityName);
+		KaosSlateIM::DrawLabledText(TEXT("Activated"), FString::FromInt(Sel->Activations));
+		KaosSlateIM::DrawLabledText(TEXT("Committed"), FString::FromInt(Sel->Commits));
+		KaosSlateIM::DrawLabledText(TEXT("Ended / Cancelled"), FString::Printf(TEXT("%d / %d"), Sel->Ends, Sel->Cancels));
+		KaosSlateIM::DrawLabledText(TEXT("Predicted / Confirmed / Rejected"), FString::Printf(TEXT("%d / %d / %d"), Sel->Predicted, Sel->Confirmed, Sel->Rejected));
+
+		KaosSlateIM::DrawHistogram(TEXT("Activate to Commit"), Sel->ActivateToCommit);
+		KaosSlateIM::DrawHistogram(TEXT("Activate to End"), Sel->ActivateToEnd);
+		KaosSlateIM::DrawHistogram(TEXT("Predicted to Server Confirmed"), Sel->PredictedToConfirmed);
+
+		if (!Sel->FailureReasons.IsEmpty())
+		{
+			SlateIM::Spacer(FVector2D(0, 8));
+			KaosSlateIM::SubHeaderText(TEXT("Failure Reasons"));
+			for (const auto& [Reason, Count] : Sel->FailureReasons)
+			{
+				KaosSlateIM::DrawLabledText(Reason, FString::FromInt(Count));
+			}
+		}
+	}
+	else
+	{
+		KaosSlateIM::WarningText(TEXT("Click an abilities name on the left to view its histograms here."));
+	}
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+FSlateIcon FKaosWorldDebugger_AbilityLatency::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Profiler.Tab");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,199 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_AbilitySystemStats.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "KaosSlateIMHelpers.h"
+
+namespace KaosAbilitySystemStats
+{
+	static const FName GroupName = TEXT("STATGROUP_AbilitySystem");
+}
+
+void FKaosWorldDebugger_AbilitySystemStats::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	UWorld* World = ContextActor ? ContextActor->GetWorld() : Context.ContextWorld.Get();
+
+	SlateIM::BeginHorizontalStack();
+	if (SlateIM::Button(TEXT("Toggle 'stat AbilitySystem'")) && GEngine)
+	{
+		GEngine->Exec(World, TEXT("stat AbilitySystem"));
+	}
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Rolling Frames:"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(RollingFrames, 10, MaxHistoryFrames);
+	SlateIM::Spacer(FVector2D(12, 0));
+	if (SlateIM::Button(TEXT("Reset")))
+	{
+		StatHistories.Reset();
+		StatOrder.Reset();
+		SelectedStat.Reset();
+	}
+	SlateIM::EndHorizontalStack();
+
+	if (!KaosDebuggerStats::AreStatsAvailable())
+	{
+		KaosSlateIM::WarningText(TEXT("Stats are compiled out."));
+		return;
+	}
+
+	if (!KaosDebuggerStats::IsGroupActive(KaosAbilitySystemStats::GroupName))
+	{
+		KaosSlateIM::WarningText(TEXT("Stat group not enabled, toggle 'stat AbilitySystem' to start sampling."));
+		return;
+	}
+
+	SampleStats();
+	if (StatOrder.IsEmpty())
+	{
+		SlateIM::Text(TEXT("Waiting for the first stats frame..."));
+		return;
+	}
+
+	SlateIM::BeginHorizontalStack();
+	DrawStatTable();
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	DrawSelectedStat();
+	SlateIM::EndHorizontalStack();
+}
+
+void FKaosWorldDebugger_AbilitySystemStats::SampleStats()
+{
+	GatheredStats.Reset();
+	KaosDebuggerStats::GetGroupStats(KaosAbilitySystemStats::GroupName, GatheredStats);
+
+	bool bNewStats = false;
+	for (const FKaosStatValue& Value : GatheredStats)
+	{
+		FKaosStatHistory* History = StatHistories.Find(Value.StatName);
+		if (!History)
+		{
+			History = &StatHistories.Add(Value.StatName);
+			StatOrder.Add(Value.StatName);
+			bNewStats = true;
+		}
+
+		History->Latest = Value;
+		// The tab can draw more than once per frame, only one sample a frame keeps the average honest
+		if (History->LastSampledFrame != GFrameCounter)
+		{
+			History->History.Push(Value.Average);
+			History->LastSampledFrame = GFrameCounter;
+		}
+	}
+
+	if (bNewStats)
+	{
+		// Cycle stats first, they are what the rest of the tab is correlated against
+		StatOrder.Sort([this](const FName& A, const FName& B)
+		{
+			const FKaosStatValue& ValueA = StatHistories.FindChecked(A).Latest;
+			const FKaosStatValue& ValueB = StatHistories.FindChecked(B).Latest;
+			return ValueA.bIsCycle != ValueB.bIsCycle ? ValueA.bIsCycle : ValueA.StatName.LexicalLess(ValueB.StatName);
+		});
+	}
+}
+
+void FKaosWorldDebugger_AbilitySystemStats::DrawStatTable()
+{
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Stat"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Frame"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Calls"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Rolling Avg"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Rolling Max"));
+
+	for (const FName& StatName : StatOrder)
+	{
+		const FKaosStatHistory& History = StatHistories.FindChecked(StatName);
+		const FKaosStatValue& Latest = History.Latest;
+
+		const int32 NumFrames = FMath::Min(RollingFrames, History.History.Num());
+		double Sum = 0.0;
+		double Max = 0.0;
+		for (int32 Index = History.History.Num() - NumFrames; Index < History.History.Num(); ++Index)
+		{
+			Sum += History.History[Index];
+			Max = FMath::Max(Max, History.History[Index]);
+		}
+		const double RollingAverage = NumFrames > 0 ? Sum / NumFrames : 0.0;
+
+		auto Format = [&Latest](double Value)
+		{
+			return Latest.bIsCycle ? FString::Printf(TEXT("%.3f ms"), Value) : FString::Printf(TEXT("%.1f"), Value);
+		};
+
+		if (SlateIM::NextTableCell() && SlateIM::Button(Latest.Description.IsEmpty() ? StatName.ToString() : Latest.Description, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+		{
+			SelectedStat = StatName;
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(Format(Latest.Average));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Latest.bIsCycle ? FString::FromInt(Latest.CallCount) : FString(TEXT("-")));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Format(RollingAverage));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Format(Max));
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_AbilitySystemStats::DrawSelectedStat()
+{
+	SlateIM::BeginVerticalStack();
+	const FKaosStatHistory* History = SelectedStat.IsSet() ? StatHistories.Find(SelectedStat.GetValue()) : nullptr;
+	if (History && !History->History.IsEmpty())
+	{
+		const FKaosStatValue& Latest = History->Latest;
+		KaosSlateIM::HeaderText(Latest.Description.IsEmpty() ? Latest.StatName.ToString() : Latest.Description);
+		KaosSlateIM::DrawLabledText(TEXT("Stat"), Latest.StatName.ToString());
+		KaosSlateIM::DrawLabledText(TEXT("Frames Recorded"), FString::Printf(TEXT("%d / %d"), History->History.Num(), History->History.Capacity()));
+
+		TArray<FVector2D> Points;
+		Points.Reserve(History->History.Num());
+		for (int32 Index = 0; Index < History->History.Num(); ++Index)
+		{
+			Points.Emplace(Index, History->History[Index]);
+		}
+
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::MinHeight(160.f);
+		SlateIM::BeginGraph();
+		SlateIM::GraphLine(Points, FLinearColor(1.f, 0.6f, 0.2f), 1.5f);
+		SlateIM::EndGraph();
+	}
+	else
+	{
+		KaosSlateIM::WarningText(TEXT("Click a stat on the left to plot its history here."));
+	}
+	SlateIM::EndVerticalStack();
+}
+
+FSlateIcon FKaosWorldDebugger_AbilitySystemStats::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.StatsViewer");
+
+	return MyIcon;
+}
+#endif
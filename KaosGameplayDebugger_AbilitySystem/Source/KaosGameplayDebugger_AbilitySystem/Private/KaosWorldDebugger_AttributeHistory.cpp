@@ -0,0 +1,131 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_AttributeHistory.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
+#include "KaosSlateIMHelpers.h"
+
+void FKaosWorldDebugger_AttributeHistory::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	FKaosAttributeHistoryRecorder& Recorder = FKaosGameplayDebugger_AbilitySystemModule::Get().GetAttributeHistory();
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Sample Rate (Hz)"));
+	float SampleRate = Recorder.GetSampleRate();
+	SlateIM::MinWidth(80.f);
+	SlateIM::SpinBox(SampleRate, 0.1f, 120.f);
+	Recorder.SetSampleRate(SampleRate);
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("History (s)"));
+	float HistorySeconds = Recorder.GetHistorySeconds();
+	SlateIM::MinWidth(80.f);
+	SlateIM::SpinBox(HistorySeconds, 1.f, 3600.f);
+	Recorder.SetHistorySeconds(HistorySeconds);
+	// Shrinking the history must not leave the window asking for samples that no longer exist
+	WindowSeconds = FMath::Min(WindowSeconds, Recorder.GetHistorySeconds());
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Window (s)"));
+	SlateIM::MinWidth(80.f);
+	SlateIM::SpinBox(WindowSeconds, 1.f, Recorder.GetHistorySeconds());
+	SlateIM::Spacer(FVector2D(12, 0));
+	if (SlateIM::Button(TEXT("Unpin All")))
+	{
+		Recorder.UnpinAll();
+	}
+	SlateIM::EndHorizontalStack();
+
+	TArray<FKaosAttributeHistoryRecorder::FKaosPinnedAttribute>& PinnedAttributes = Recorder.GetPinnedAttributes();
+	KaosSlateIM::DrawLabledText(TEXT("Pinned"), FString::FromInt(PinnedAttributes.Num()));
+	KaosSlateIM::DrawLabledText(TEXT("Samples Per Attribute"), FString::Printf(TEXT("%d (max %d)"), Recorder.GetSamplesPerAttribute(), FKaosAttributeHistoryRecorder::MaxSamplesPerAttribute));
+	KaosSlateIM::DrawLabledText(TEXT("Memory"), FString::Printf(TEXT("%.1f KB"), Recorder.GetAllocatedSize() / 1024.0));
+
+	if (PinnedAttributes.IsEmpty())
+	{
+		KaosSlateIM::WarningText(TEXT("Pin attributes from the Gameplay Attributes tab to record them here."));
+		return;
+	}
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+	int32 UnpinIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < PinnedAttributes.Num(); ++Index)
+	{
+		FKaosAttributeHistoryRecorder::FKaosPinnedAttribute& Pinned = PinnedAttributes[Index];
+		const TArray<FVector2D>& Points = Recorder.GetPlotPoints(Pinned, WindowSeconds, PlotBuckets);
+
+		float MinValue = Points.IsEmpty() ? 0.f : Points[0].Y;
+		float MaxValue = MinValue;
+		for (const FVector2D& Point : Points)
+		{
+			MinValue = FMath::Min(MinValue, static_cast<float>(Point.Y));
+			MaxValue = FMath::Max(MaxValue, static_cast<float>(Point.Y));
+		}
+
+		SlateIM::Padding(FMargin(4));
+		SlateIM::BeginHorizontalStack();
+		SlateIM::VAlign(VAlign_Center);
+		KaosSlateIM::SubHeaderText(FString::Printf(TEXT("%s.%s"), *Pinned.OwnerName, *Pinned.AttributeName), Pinned.AbilitySystem.IsValid() ? FSlateColor::UseForeground() : FSlateColor::UseSubduedForeground());
+		SlateIM::Spacer(FVector2D(12, 0));
+		if (SlateIM::Button(TEXT("Unpin"), &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+		{
+			UnpinIndex = Index;
+		}
+		SlateIM::EndHorizontalStack();
+
+		if (!Pinned.AbilitySystem.IsValid())
+		{
+			KaosSlateIM::WarningText(TEXT("Ability System Component is gone, history is frozen."));
+		}
+		KaosSlateIM::DrawLabledText(TEXT("Current"), Pinned.Samples.IsEmpty() ? TEXT("-") : FString::Printf(TEXT("%.2f"), Pinned.Samples.Last().Value));
+		KaosSlateIM::DrawLabledText(TEXT("Window Min / Max"), FString::Printf(TEXT("%.2f / %.2f"), MinValue, MaxValue));
+		KaosSlateIM::DrawLabledText(TEXT("Samples"), FString::Printf(TEXT("%d / %d (%d plotted)"), Pinned.Samples.Num(), Pinned.Samples.Capacity(), Points.Num()));
+		KaosSlateIM::DrawLabledText(TEXT("Memory"), FString::Printf(TEXT("%.1f KB"), Recorder.GetAllocatedSize(Pinned) / 1024.0));
+
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::MinHeight(120.f);
+		SlateIM::BeginGraph();
+		SlateIM::GraphLine(Points, FLinearColor(0.3f, 0.8f, 1.f), 1.5f);
+		SlateIM::EndGraph();
+		SlateIM::Spacer(FVector2D(0, 8));
+	}
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+
+	if (UnpinIndex != INDEX_NONE)
+	{
+		Recorder.UnpinAt(UnpinIndex);
+	}
+}
+
+FSlateIcon FKaosWorldDebugger_AttributeHistory::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "GraphEditor.TimelineGlyph");
+
+	return MyIcon;
+}
+#endif
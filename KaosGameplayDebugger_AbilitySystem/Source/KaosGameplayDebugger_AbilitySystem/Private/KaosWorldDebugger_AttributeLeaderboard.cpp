@@ -0,0 +1,292 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_AttributeLeaderboard.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "KaosAbilitySystemWorldBinder.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
+#include "KaosGameplayDebuggerModule.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_AttributeLeaderboard::~FKaosWorldDebugger_AttributeLeaderboard()
+{
+	UnbindAll();
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	if (BoundWorld != World)
+	{
+		UnbindAll();
+		BoundWorld = World;
+		AvailableAttributes.Reset();
+		AttributeNames.Reset();
+		KnownAttributeSetClasses.Reset();
+		bForceAttributeComboRefresh = true;
+		TimeSinceLastScan = TNumericLimits<double>::Max();
+	}
+
+	// New attribute sets only reach the attribute list once a scan finds them
+	TimeSinceLastScan += Context.DeltaTime;
+	if (TimeSinceLastScan >= ScanInterval)
+	{
+		ScanWorld(World);
+		TimeSinceLastScan = 0;
+	}
+
+	if (AvailableAttributes.IsEmpty())
+	{
+		KaosSlateIM::WarningText(TEXT("No Gameplay Attributes found in this world."));
+		return;
+	}
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Attribute:"));
+	SlateIM::MinWidth(220.f);
+	SelectedAttributeIndex = FMath::Clamp(SelectedAttributeIndex, 0, AttributeNames.Num() - 1);
+	SlateIM::ComboBox(AttributeNames, SelectedAttributeIndex, bForceAttributeComboRefresh);
+	bForceAttributeComboRefresh = false;
+	SlateIM::Spacer({12.f, 0.f});
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Show:"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(NumShown, 1, 100);
+	SlateIM::EndHorizontalStack();
+
+	if (AvailableAttributes[SelectedAttributeIndex] != BoundAttribute)
+	{
+		BindAttribute(AvailableAttributes[SelectedAttributeIndex]);
+	}
+
+	if (bRankingDirty || TopEntries.Num() != FMath::Min(NumShown, Entries.Num()))
+	{
+		UpdateRanking();
+	}
+
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(Entries.Num()));
+	KaosSlateIM::DrawLabledText(TEXT("Average"), Entries.IsEmpty() ? FString(TEXT("-")) : FString::Printf(TEXT("%.2f"), ValueSum / Entries.Num()));
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginHorizontalStack();
+	DrawRankingTable(TEXT("Highest"), TopEntries);
+	SlateIM::Spacer({12.f, 0.f});
+	DrawRankingTable(TEXT("Lowest"), BottomEntries);
+	SlateIM::EndHorizontalStack();
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::ScanWorld(UWorld* World)
+{
+	TArray<UAbilitySystemComponent*> Components;
+	KaosAbilitySystem::GetComponentsInWorld(World, Components);
+
+	FKaosAbilitySystemDebugCache& DebugCache = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache();
+	bool bAttributesChanged = false;
+	for (UAbilitySystemComponent* AbilityComp : Components)
+	{
+		for (const UAttributeSet* AttributeSet : AbilityComp->GetSpawnedAttributes())
+		{
+			UClass* AttributeSetClass = AttributeSet ? AttributeSet->GetClass() : nullptr;
+			if (!AttributeSetClass || KnownAttributeSetClasses.Contains(AttributeSetClass))
+			{
+				continue;
+			}
+
+			KnownAttributeSetClasses.Add(AttributeSetClass);
+			const FKaosAbilitySystemDebugCache::FKaosAttributeSetMetadata& Metadata = DebugCache.GetAttributeSetMetadata(AttributeSetClass);
+			for (const FKaosAbilitySystemDebugCache::FKaosAttributeMetadata& AttributeMetadata : Metadata.Attributes)
+			{
+				AvailableAttributes.Add(AttributeMetadata.Attribute);
+				bAttributesChanged = true;
+			}
+		}
+
+		if (BoundAttribute.IsValid() && !Entries.Contains(AbilityComp) && AbilityComp->HasAttributeSetForAttribute(BoundAttribute))
+		{
+			AddEntry(AbilityComp);
+		}
+	}
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		// Attribute sets can be removed at runtime, the entry goes with them
+		UAbilitySystemComponent* AbilityComp = It.Key().Get();
+		if (!AbilityComp || !AbilityComp->HasAttributeSetForAttribute(BoundAttribute))
+		{
+			if (AbilityComp)
+			{
+				AbilityComp->GetGameplayAttributeValueChangeDelegate(BoundAttribute).Remove(It.Value().ValueChangeHandle);
+			}
+			ValueSum -= It.Value().Value;
+			It.RemoveCurrent();
+			bRankingDirty = true;
+		}
+	}
+
+	if (bAttributesChanged)
+	{
+		const FGameplayAttribute PreviousSelection = AvailableAttributes.IsValidIndex(SelectedAttributeIndex) ? AvailableAttributes[SelectedAttributeIndex] : FGameplayAttribute();
+		AvailableAttributes.Sort([](const FGameplayAttribute& A, const FGameplayAttribute& B)
+		{
+			return A.GetName() < B.GetName();
+		});
+		AttributeNames.Reset(AvailableAttributes.Num());
+		for (const FGameplayAttribute& Attribute : AvailableAttributes)
+		{
+			AttributeNames.Add(FString::Printf(TEXT("%s.%s"), *GetNameSafe(Attribute.GetAttributeSetClass()), *Attribute.AttributeName));
+		}
+		SelectedAttributeIndex = FMath::Max(AvailableAttributes.IndexOfByKey(PreviousSelection), 0);
+		bForceAttributeComboRefresh = true;
+	}
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::BindAttribute(const FGameplayAttribute& Attribute)
+{
+	UnbindAll();
+	BoundAttribute = Attribute;
+
+	TArray<UAbilitySystemComponent*> Components;
+	KaosAbilitySystem::GetComponentsInWorld(BoundWorld.Get(), Components);
+	for (UAbilitySystemComponent* AbilityComp : Components)
+	{
+		if (AbilityComp->HasAttributeSetForAttribute(Attribute))
+		{
+			AddEntry(AbilityComp);
+		}
+	}
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::AddEntry(UAbilitySystemComponent* AbilityComp)
+{
+	FKaosLeaderboardEntry& Entry = Entries.Add(AbilityComp);
+	Entry.Owner = AbilityComp->GetOwnerActor();
+	Entry.OwnerName = GetNameSafe(AbilityComp->GetOwnerActor());
+	Entry.Value = AbilityComp->GetNumericAttribute(BoundAttribute);
+	Entry.ValueChangeHandle = AbilityComp->GetGameplayAttributeValueChangeDelegate(BoundAttribute).AddRaw(this, &FKaosWorldDebugger_AttributeLeaderboard::OnAttributeValueChanged, FEntryKey(AbilityComp));
+	ValueSum += Entry.Value;
+	bRankingDirty = true;
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::UnbindAll()
+{
+	for (const auto& Pair : Entries)
+	{
+		if (UAbilitySystemComponent* AbilityComp = Pair.Key.Get())
+		{
+			AbilityComp->GetGameplayAttributeValueChangeDelegate(BoundAttribute).Remove(Pair.Value.ValueChangeHandle);
+		}
+	}
+
+	BoundAttribute = FGameplayAttribute();
+	Entries.Reset();
+	ValueSum = 0.0;
+	TopEntries.Reset();
+	BottomEntries.Reset();
+	bRankingDirty = false;
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::OnAttributeValueChanged(const FOnAttributeChangeData& ChangeData, FEntryKey AbilityComp)
+{
+	if (FKaosLeaderboardEntry* Entry = Entries.Find(AbilityComp))
+	{
+		ValueSum += ChangeData.NewValue - Entry->Value;
+		Entry->Value = ChangeData.NewValue;
+		bRankingDirty = true;
+	}
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::UpdateRanking()
+{
+	// Bounded heaps keep this at O(M log N), there is no need to order the whole field to show its ends
+	auto ValueOf = [this](const FEntryKey& Key) { return Entries.FindChecked(Key).Value; };
+	auto Lower = [&ValueOf](const FEntryKey& A, const FEntryKey& B) { return ValueOf(A) < ValueOf(B); };
+	auto Higher = [&ValueOf](const FEntryKey& A, const FEntryKey& B) { return ValueOf(A) > ValueOf(B); };
+
+	TopEntries.Reset(NumShown + 1);
+	BottomEntries.Reset(NumShown + 1);
+	for (const auto& Pair : Entries)
+	{
+		// The top heap keeps its smallest value on top so it is the one evicted, the bottom heap the reverse
+		TopEntries.HeapPush(Pair.Key, Lower);
+		if (TopEntries.Num() > NumShown)
+		{
+			TopEntries.HeapPopDiscard(Lower, EAllowShrinking::No);
+		}
+
+		BottomEntries.HeapPush(Pair.Key, Higher);
+		if (BottomEntries.Num() > NumShown)
+		{
+			BottomEntries.HeapPopDiscard(Higher, EAllowShrinking::No);
+		}
+	}
+
+	TopEntries.Sort(Higher);
+	BottomEntries.Sort(Lower);
+	bRankingDirty = false;
+}
+
+void FKaosWorldDebugger_AttributeLeaderboard::DrawRankingTable(const TCHAR* Title, const TArray<FEntryKey>& Ranking)
+{
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::BeginVerticalStack();
+	KaosSlateIM::SubHeaderText(Title);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(40.f);  SlateIM::AddTableColumn(TEXT("#"));
+	SlateIM::InitialTableColumnWidth(240.f); SlateIM::AddTableColumn(TEXT("Owner"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Value"));
+
+	for (int32 Rank = 0; Rank < Ranking.Num(); ++Rank)
+	{
+		const FKaosLeaderboardEntry& Entry = Entries.FindChecked(Ranking[Rank]);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Rank + 1));
+		if (SlateIM::NextTableCell())
+		{
+			if (SlateIM::Button(Entry.OwnerName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+			{
+				FKaosGameplayDebuggerModule::Get().SelectActor(Entry.Owner.Get());
+			}
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.2f"), Entry.Value));
+	}
+	SlateIM::EndTable();
+	SlateIM::EndVerticalStack();
+}
+
+FSlateIcon FKaosWorldDebugger_AttributeLeaderboard::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "AnimGraph.Attribute.Attributes.Icon");
+
+	return MyIcon;
+}
+#endif
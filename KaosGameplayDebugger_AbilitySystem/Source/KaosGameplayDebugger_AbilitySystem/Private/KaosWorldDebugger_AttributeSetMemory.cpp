@@ -0,0 +1,271 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_AttributeSetMemory.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/World.h"
+#include "GameplayEffectAggregator.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
+#include "KaosSlateIMHelpers.h"
+
+namespace KaosAttributeSetMemory
+{
+	// Fixed part only, the mod channels grow with the number of modifiers applied
+	static constexpr int32 AggregatorBytes = sizeof(FAggregator) + sizeof(FAggregatorRef);
+
+	static FString FormatBytes(int64 Bytes)
+	{
+		return Bytes >= 1024 ? FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0) : FString::Printf(TEXT("%lld B"), Bytes);
+	}
+}
+
+FKaosWorldDebugger_AttributeSetMemory::FKaosWorldDebugger_AttributeSetMemory()
+	: Rollup(
+		&FKaosWorldDebugger_AttributeSetMemory::ProcessAbilitySystem,
+		[](FKaosMemoryRollup& Result)
+		{
+			Result.OwnerClasses.Sort([](const FKaosOwnerClassMemory& A, const FKaosOwnerClassMemory& B)
+			{
+				return A.SetBytes + A.AggregatorBytes > B.SetBytes + B.AggregatorBytes;
+			});
+			Result.SetClasses.Sort([](const FKaosAttributeSetClassMemory& A, const FKaosAttributeSetClassMemory& B)
+			{
+				return (int64)A.Instances * A.PropertiesSize > (int64)B.Instances * B.PropertiesSize;
+			});
+			Result.OwnerClassIndices.Reset();
+			Result.SetClassIndices.Reset();
+		},
+		nullptr,
+		5.f)
+{
+}
+
+void FKaosWorldDebugger_AttributeSetMemory::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	UWorld* World = ContextActor ? ContextActor->GetWorld() : Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+	Rollup.Tick(World, Context.DeltaTime);
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	if (const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor))
+	{
+		DrawSelectedMemory(ASC);
+	}
+
+	DrawRollup();
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+int32 FKaosWorldDebugger_AttributeSetMemory::CountAggregators(const UAbilitySystemComponent* AbilityComp)
+{
+	// The aggregator map is private to the container, so count the attributes the active effects modify instead.
+	// Aggregators outlive the effects that created them, which makes this a lower bound.
+	TSet<FGameplayAttribute> ModifiedAttributes;
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		if (ActiveGE.Spec.Def)
+		{
+			for (const FGameplayModifierInfo& Modifier : ActiveGE.Spec.Def->Modifiers)
+			{
+				ModifiedAttributes.Add(Modifier.Attribute);
+			}
+		}
+	}
+	return ModifiedAttributes.Num();
+}
+
+void FKaosWorldDebugger_AttributeSetMemory::ProcessAbilitySystem(const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC, FKaosMemoryRollup& Result)
+{
+	const UAbilitySystemComponent* AbilityComp = WeakASC.Get();
+	if (!IsValid(AbilityComp))
+	{
+		return;
+	}
+
+	const AActor* Owner = AbilityComp->GetOwnerActor();
+	UClass* OwnerClass = Owner ? Owner->GetClass() : nullptr;
+	int32& OwnerIndex = Result.OwnerClassIndices.FindOrAdd(OwnerClass, INDEX_NONE);
+	if (OwnerIndex == INDEX_NONE)
+	{
+		OwnerIndex = Result.OwnerClasses.AddDefaulted();
+		Result.OwnerClasses[OwnerIndex].OwnerClassName = GetNameSafe(OwnerClass);
+	}
+	FKaosOwnerClassMemory& OwnerMemory = Result.OwnerClasses[OwnerIndex];
+	++OwnerMemory.Components;
+	++Result.TotalComponents;
+
+	FKaosAbilitySystemDebugCache& DebugCache = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache();
+	for (const UAttributeSet* AttributeSet : AbilityComp->GetSpawnedAttributes())
+	{
+		if (!AttributeSet)
+		{
+			continue;
+		}
+
+		UClass* SetClass = AttributeSet->GetClass();
+		const FKaosAbilitySystemDebugCache::FKaosAttributeSetMetadata& Layout = DebugCache.GetAttributeSetMetadata(SetClass);
+		OwnerMemory.AttributeSets++;
+		OwnerMemory.AttributeData += Layout.AttributeDataCount;
+		OwnerMemory.SetBytes += Layout.PropertiesSize;
+		OwnerMemory.AttributeDataBytes += Layout.AttributeDataBytes;
+
+		int32& SetIndex = Result.SetClassIndices.FindOrAdd(SetClass, INDEX_NONE);
+		if (SetIndex == INDEX_NONE)
+		{
+			SetIndex = Result.SetClasses.AddDefaulted();
+			Result.SetClasses[SetIndex].SetClassName = Layout.ClassName;
+			Result.SetClasses[SetIndex].PropertiesSize = Layout.PropertiesSize;
+			Result.SetClasses[SetIndex].AttributeDataCount = Layout.AttributeDataCount;
+		}
+		++Result.SetClasses[SetIndex].Instances;
+
+		++Result.TotalAttributeSets;
+		Result.TotalBytes += Layout.PropertiesSize;
+	}
+
+	const int32 Aggregators = CountAggregators(AbilityComp);
+	OwnerMemory.Aggregators += Aggregators;
+	OwnerMemory.AggregatorBytes += Aggregators * KaosAttributeSetMemory::AggregatorBytes;
+	Result.TotalBytes += Aggregators * KaosAttributeSetMemory::AggregatorBytes;
+}
+
+void FKaosWorldDebugger_AttributeSetMemory::DrawSelectedMemory(const UAbilitySystemComponent* AbilityComp)
+{
+	using namespace KaosAttributeSetMemory;
+
+	KaosSlateIM::HeaderText(GetNameSafe(AbilityComp->GetOwnerActor()));
+
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Attribute Set"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Size"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Attributes"));
+	SlateIM::InitialTableColumnWidth(120.f); SlateIM::AddTableColumn(TEXT("Attribute Data"));
+
+	int64 TotalBytes = 0;
+	FKaosAbilitySystemDebugCache& DebugCache = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache();
+	for (const UAttributeSet* AttributeSet : AbilityComp->GetSpawnedAttributes())
+	{
+		if (!AttributeSet)
+		{
+			continue;
+		}
+
+		const FKaosAbilitySystemDebugCache::FKaosAttributeSetMetadata& Layout = DebugCache.GetAttributeSetMetadata(AttributeSet->GetClass());
+		TotalBytes += Layout.PropertiesSize;
+		if (SlateIM::NextTableCell()) SlateIM::Text(Layout.ClassName);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatBytes(Layout.PropertiesSize));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Layout.AttributeDataCount));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatBytes(Layout.AttributeDataBytes));
+	}
+	SlateIM::EndTable();
+
+	const int32 Aggregators = CountAggregators(AbilityComp);
+	KaosSlateIM::DrawLabledText(TEXT("Attribute Sets"), FormatBytes(TotalBytes));
+	KaosSlateIM::DrawLabledText(TEXT("Aggregators (at least)"), FString::Printf(TEXT("%d, %s"), Aggregators, *FormatBytes(Aggregators * AggregatorBytes)));
+	KaosSlateIM::DrawLabledText(TEXT("Per FGameplayAttributeData"), FormatBytes(sizeof(FGameplayAttributeData)));
+}
+
+void FKaosWorldDebugger_AttributeSetMemory::DrawRollup()
+{
+	using namespace KaosAttributeSetMemory;
+
+	SlateIM::Spacer(FVector2D(0, 8));
+	KaosSlateIM::HeaderText(TEXT("World Roll-up"));
+
+	Rollup.DrawControls();
+
+	if (!Rollup.HasResults())
+	{
+		SlateIM::Text(TEXT("Waiting for first pass..."));
+		return;
+	}
+
+	const FKaosMemoryRollup& Result = Rollup.GetResults();
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(Result.TotalComponents));
+	KaosSlateIM::DrawLabledText(TEXT("Attribute Sets"), FString::FromInt(Result.TotalAttributeSets));
+	KaosSlateIM::DrawLabledText(TEXT("Total"), FormatBytes(Result.TotalBytes));
+
+	SlateIM::Spacer(FVector2D(0, 8));
+	KaosSlateIM::SubHeaderText(TEXT("By Owner Class"));
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Owner Class"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Count"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Sets"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Set Bytes"));
+	SlateIM::InitialTableColumnWidth(120.f); SlateIM::AddTableColumn(TEXT("Attribute Data"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Aggregators"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Per Owner"));
+
+	for (const FKaosOwnerClassMemory& OwnerMemory : Result.OwnerClasses)
+	{
+		const int64 PerOwner = (OwnerMemory.SetBytes + OwnerMemory.AggregatorBytes) / FMath::Max(OwnerMemory.Components, 1);
+		if (SlateIM::NextTableCell()) SlateIM::Text(OwnerMemory.OwnerClassName);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(OwnerMemory.Components));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(OwnerMemory.AttributeSets));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatBytes(OwnerMemory.SetBytes));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%d, %s"), OwnerMemory.AttributeData, *FormatBytes(OwnerMemory.AttributeDataBytes)));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%d, %s"), OwnerMemory.Aggregators, *FormatBytes(OwnerMemory.AggregatorBytes)));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatBytes(PerOwner));
+	}
+	SlateIM::EndTable();
+
+	SlateIM::Spacer(FVector2D(0, 8));
+	KaosSlateIM::SubHeaderText(TEXT("By Attribute Set Class"));
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Attribute Set"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Instances"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Size"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Attributes"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Total"));
+
+	for (const FKaosAttributeSetClassMemory& SetMemory : Result.SetClasses)
+	{
+		if (SlateIM::NextTableCell()) SlateIM::Text(SetMemory.SetClassName);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(SetMemory.Instances));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatBytes(SetMemory.PropertiesSize));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(SetMemory.AttributeDataCount));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FormatBytes((int64)SetMemory.Instances * SetMemory.PropertiesSize));
+	}
+	SlateIM::EndTable();
+}
+
+FSlateIcon FKaosWorldDebugger_AttributeSetMemory::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.StatsViewer");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,160 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_EffectRates.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "GameplayEffect.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_EffectRates::FKaosWorldDebugger_EffectRates()
+{
+	Binder.OnBind.BindRaw(this, &FKaosWorldDebugger_EffectRates::BindAbilitySystem);
+	Binder.OnUnbind.BindRaw(this, &FKaosWorldDebugger_EffectRates::UnbindAbilitySystem);
+}
+
+FKaosWorldDebugger_EffectRates::~FKaosWorldDebugger_EffectRates()
+{
+	Binder.UnbindAll();
+}
+
+void FKaosWorldDebugger_EffectRates::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::CheckBox(TEXT("Record"), bRecording);
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Rate Window (s):"));
+	SlateIM::MinWidth(60.f);
+	SlateIM::SpinBox(RateWindow, 0.25f, 10.f);
+	SlateIM::Spacer(FVector2D(12, 0));
+	if (SlateIM::Button(TEXT("Reset")))
+	{
+		Counters.Reset();
+	}
+	SlateIM::EndHorizontalStack();
+
+	TickRecording(World, Context.DeltaTime);
+
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(Binder.Num()));
+	KaosSlateIM::DrawLabledText(TEXT("Applied / s"), FString::Printf(TEXT("%.1f (peak %.1f)"), Counters.GetTotalRate(Applied), Counters.GetPeakTotalRate(Applied)));
+	KaosSlateIM::DrawLabledText(TEXT("Periodic / s"), FString::Printf(TEXT("%.1f (peak %.1f)"), Counters.GetTotalRate(Periodic), Counters.GetPeakTotalRate(Periodic)));
+
+	if (Counters.GetSortedIndices().IsEmpty())
+	{
+		KaosSlateIM::WarningText(TEXT("No Gameplay Effects applied since recording started."));
+		return;
+	}
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Effect"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Applied/s"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Peak"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Periodic/s"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Peak"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Total Applied"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Total Periodic"));
+
+	for (const int32 Index : Counters.GetSortedIndices())
+	{
+		const FEffectCounters::FRow& Row = Counters.GetRow(Index);
+		if (SlateIM::NextTableCell()) SlateIM::Text(Row.Data, Index == Counters.OverflowIndex ? FLinearColor::Yellow : FLinearColor::White);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1f"), Row.Rates[Applied]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1f"), Row.PeakRates[Applied]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1f"), Row.Rates[Periodic]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1f"), Row.PeakRates[Periodic]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%u"), Row.Counts[Applied]));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%u"), Row.Counts[Periodic]));
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_EffectRates::BindAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	AbilityComp->OnGameplayEffectAppliedDelegateToSelf.AddRaw(this, &FKaosWorldDebugger_EffectRates::OnEffectApplied);
+	AbilityComp->OnPeriodicGameplayEffectExecuteDelegateOnSelf.AddRaw(this, &FKaosWorldDebugger_EffectRates::OnPeriodicExecuted);
+}
+
+void FKaosWorldDebugger_EffectRates::UnbindAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	AbilityComp->OnGameplayEffectAppliedDelegateToSelf.RemoveAll(this);
+	AbilityComp->OnPeriodicGameplayEffectExecuteDelegateOnSelf.RemoveAll(this);
+}
+
+int32 FKaosWorldDebugger_EffectRates::FindCounterIndex(const UGameplayEffect* Definition)
+{
+	UClass* EffectClass = Definition ? Definition->GetClass() : nullptr;
+	return Counters.FindOrAddRow(EffectClass, [EffectClass](FString& EffectName)
+	{
+		EffectName = GetNameSafe(EffectClass);
+	});
+}
+
+void FKaosWorldDebugger_EffectRates::OnEffectApplied(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	Counters.Count(FindCounterIndex(Spec.Def), Applied);
+}
+
+void FKaosWorldDebugger_EffectRates::OnPeriodicExecuted(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	Counters.Count(FindCounterIndex(Spec.Def), Periodic);
+}
+
+void FKaosWorldDebugger_EffectRates::TickRecording(UWorld* World, float DeltaTime)
+{
+	if (LastTickFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastTickFrame = GFrameCounter;
+
+	if (bRecording)
+	{
+		Binder.Tick(World, DeltaTime);
+	}
+	else
+	{
+		Binder.UnbindAll();
+	}
+
+	Counters.Tick(World->GetRealTimeSeconds(), RateWindow);
+}
+
+FSlateIcon FKaosWorldDebugger_EffectRates::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Profiler.EventGraph.ExpandHotPath16");
+
+	return MyIcon;
+}
+#endif
@@ -32,22 +32,23 @@ void FKaosWorldDebugger_GameplayAbilities::DrawDetails(const FKaosDebuggerContex
 	{
 		if (ContextActor != LastSelectedActor)
 		{
-			SelectedAbilityName.Reset();
+			SelectedAbilityHandle.Reset();
 		}
 		LastSelectedActor = ContextActor;
-		TArray<FKaosGameplayAbilityDebug> Abilities = CollectAbilityData(ASC);
-		if (Abilities.IsEmpty())
+		UpdateAbilityRows(ASC);
+		RefreshVolatileFields(ASC);
+		if (AbilityRows.IsEmpty())
 		{
 			SlateIM::Text(TEXT("No Gameplay Abilities found."));
 			return;
 		}
 
 		SlateIM::BeginHorizontalStack();
-		DrawWorldDebugger_Abilities(Abilities);
+		DrawWorldDebugger_Abilities();
 		SlateIM::Fill();
 		SlateIM::HAlign(HAlign_Fill);
 		SlateIM::VAlign(VAlign_Fill);
-		DrawWorldDebugger_AbilityDetails(Abilities);
+		DrawWorldDebugger_AbilityDetails();
 		SlateIM::EndHorizontalStack();
 	}
 	else
@@ -63,7 +64,15 @@ void FKaosWorldDebugger_GameplayAbilities::DrawDetails(const FKaosDebuggerContex
 	}
 }
 
-void FKaosWorldDebugger_GameplayAbilities::DrawWorldDebugger_Abilities(const TArray<FKaosGameplayAbilityDebug>& Abilities)
+FKaosWorldDebugger_GameplayAbilities::FKaosGameplayAbilityRowText FKaosWorldDebugger_GameplayAbilities::FormatAbilityRow(const FKaosGameplayAbilityDebug& Row)
+{
+	FKaosGameplayAbilityRowText Text;
+	Text.Level = FString::FromInt(Row.Level);
+	Text.Active = Row.bIsActive ? TEXT("Active") : TEXT("Inactive");
+	return Text;
+}
+
+void FKaosWorldDebugger_GameplayAbilities::DrawWorldDebugger_Abilities()
 {
 	SlateIM::BeginTable();
 	SlateIM::FixedTableColumnWidth(250.f); SlateIM::AddTableColumn(TEXT("Ability"));
@@ -71,32 +80,31 @@ void FKaosWorldDebugger_GameplayAbilities::DrawWorldDebugger_Abilities(const TAr
 	SlateIM::FixedTableColumnWidth( 80.f);  SlateIM::AddTableColumn(TEXT("Level"));
 	SlateIM::FixedTableColumnWidth(120.f); SlateIM::AddTableColumn(TEXT("Active"));
 
-	for (const auto& A : Abilities)
+	for (const FGameplayAbilitySpecHandle& Handle : SortedHandles)
 	{
+		const FKaosGameplayAbilityDebug& A = AbilityRows.FindChecked(Handle);
+		const FKaosGameplayAbilityRowText Text = FormatAbilityRow(A);
 		if (SlateIM::NextTableCell() && SlateIM::Button(A.Ability, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
 		{
-			SelectedAbilityName  = A.Ability;
+			SelectedAbilityHandle = A.Handle;
 		}
-		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%s"), *A.Source));
-		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%d"), A.Level));
-		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%s"), A.bIsActive ? TEXT("Active") : TEXT("Inactive")));
+		if (SlateIM::NextTableCell()) SlateIM::Text(A.Source);
+		if (SlateIM::NextTableCell()) SlateIM::Text(Text.Level);
+		if (SlateIM::NextTableCell()) SlateIM::Text(Text.Active);
 	}
 	SlateIM::EndTable();
 }
 
-void FKaosWorldDebugger_GameplayAbilities::DrawWorldDebugger_AbilityDetails(const TArray<FKaosGameplayAbilityDebug>& Abilities)
+void FKaosWorldDebugger_GameplayAbilities::DrawWorldDebugger_AbilityDetails()
 {
 	SlateIM::Fill();
 	SlateIM::BeginScrollBox();
 	SlateIM::Fill();
 	SlateIM::VAlign(VAlign_Fill);
 	SlateIM::BeginVerticalStack();
-	if (SelectedAbilityName.IsSet())
+	if (SelectedAbilityHandle.IsSet())
 	{
-		const FKaosGameplayAbilityDebug* Sel = Abilities.FindByPredicate(
-			[&](const FKaosGameplayAbilityDebug& X) {
-				return X.Ability == SelectedAbilityName.GetValue();
-			});
+		const FKaosGameplayAbilityDebug* Sel = AbilityRows.Find(SelectedAbilityHandle.GetValue());
 
 		if (Sel)
 		{
@@ -151,46 +159,132 @@ FSlateIcon FKaosWorldDebugger_GameplayAbilities::GetTabIcon() const
 	return MyIcon;
 }
 
+void FKaosWorldDebugger_GameplayAbilities::UpdateAbilityRows(const UAbilitySystemComponent* AbilityComp)
+{
+	if (CachedASC != AbilityComp)
+	{
+		CachedASC = AbilityComp;
+		CachedArrayReplicationKey = INDEX_NONE;
+		CachedAbilityCount = INDEX_NONE;
+		AbilityRows.Reset();
+		SortedHandles.Reset();
+	}
+
+	// The key moves whenever a spec is added, removed or marked dirty, so an unchanged key skips the walk entirely.
+	// Without the container every frame falls through to the per spec signatures below.
+	const FGameplayAbilitySpecContainer* Container = GetAbilityContainer(AbilityComp);
+	const int32 AbilityCount = AbilityComp->GetActivatableAbilities().Num();
+	if (Container && Container->ArrayReplicationKey == CachedArrayReplicationKey && AbilityCount == CachedAbilityCount)
+	{
+		return;
+	}
+	CachedArrayReplicationKey = Container ? Container->ArrayReplicationKey : INDEX_NONE;
+	CachedAbilityCount = AbilityCount;
+
+	// Something in the container changed, only rebuild the specs that did
+	TSet<FGameplayAbilitySpecHandle> LiveHandles;
+	bool bOrderChanged = false;
+	for (const FGameplayAbilitySpec& AbilitySpec : AbilityComp->GetActivatableAbilities())
+	{
+		LiveHandles.Add(AbilitySpec.Handle);
+
+		const uint32 SpecSignature = GetSpecSignature(AbilitySpec);
+		FKaosGameplayAbilityDebug* Row = AbilityRows.Find(AbilitySpec.Handle);
+		if (Row && Row->SpecSignature == SpecSignature)
+		{
+			continue;
+		}
+
+		if (!Row)
+		{
+			Row = &AbilityRows.Add(AbilitySpec.Handle);
+			SortedHandles.Add(AbilitySpec.Handle);
+		}
+		Row->SpecSignature = SpecSignature;
+		BuildAbilityRow(AbilitySpec, *Row);
+		bOrderChanged = true;
+	}
+
+	for (auto It = AbilityRows.CreateIterator(); It; ++It)
+	{
+		if (!LiveHandles.Contains(It.Key()))
+		{
+			SortedHandles.RemoveSingle(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	if (bOrderChanged)
+	{
+		SortedHandles.Sort([this](const FGameplayAbilitySpecHandle& A, const FGameplayAbilitySpecHandle& B)
+		{
+			return AbilityRows.FindChecked(A).Ability < AbilityRows.FindChecked(B).Ability;
+		});
+	}
+}
 
-TArray<FKaosWorldDebugger_GameplayAbilities::FKaosGameplayAbilityDebug> FKaosWorldDebugger_GameplayAbilities::CollectAbilityData(
-	const UAbilitySystemComponent* AbilityComp) const
+void FKaosWorldDebugger_GameplayAbilities::RefreshVolatileFields(const UAbilitySystemComponent* AbilityComp)
 {
-	TArray<FKaosGameplayAbilityDebug> Abilities;
-	const TArray<FGameplayAbilitySpec>& AbilitySpecs = AbilityComp->GetActivatableAbilities();
-	for (int32 Idx = 0; Idx < AbilitySpecs.Num(); Idx++)
+	for (const FGameplayAbilitySpec& AbilitySpec : AbilityComp->GetActivatableAbilities())
 	{
-		const FGameplayAbilitySpec& AbilitySpec = AbilitySpecs[Idx];
-		FKaosGameplayAbilityDebug ItemData;
-
-		ItemData.Ability = GetNameSafe(AbilitySpec.Ability);
-		ItemData.Ability.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
-		ItemData.Ability.RemoveFromEnd(TEXT("_C"));
-
-		ItemData.Source = GetNameSafe(AbilitySpec.SourceObject.Get());
-		ItemData.Source.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
-
-		ItemData.Level = AbilitySpec.Level;
-		ItemData.bIsActive = AbilitySpec.IsActive();
-		ItemData.ActiveCount = AbilitySpec.ActiveCount;;
-		ItemData.InputID = AbilitySpec.InputID;
-		ItemData.SetByCallerTagMagnitudes = AbilitySpec.SetByCallerTagMagnitudes;
-		ItemData.InputPressed = AbilitySpec.InputPressed;
-		ItemData.AbilityTags = AbilitySpec.GetDynamicSpecSourceTags();
-		if (AbilitySpec.Ability)
+		if (FKaosGameplayAbilityDebug* Row = AbilityRows.Find(AbilitySpec.Handle))
 		{
-			ItemData.AbilityTags.AppendTags(AbilitySpec.Ability->GetAssetTags());
-			if (const FGameplayTagContainer* CDTags = AbilitySpec.Ability->GetCooldownTags())
-			{
-				ItemData.CooldownTags = *CDTags;
-			}
+			Row->bIsActive = AbilitySpec.IsActive();
+			Row->ActiveCount = AbilitySpec.ActiveCount;
+			Row->InputPressed = AbilitySpec.InputPressed;
 		}
-		Abilities.Add(ItemData);
 	}
-		
-	Abilities.Sort([](const FKaosGameplayAbilityDebug& A, const FKaosGameplayAbilityDebug& B)
+}
+
+uint32 FKaosWorldDebugger_GameplayAbilities::GetSpecSignature(const FGameplayAbilitySpec& AbilitySpec)
+{
+	// ReplicationKey moves whenever the server marks the spec dirty, the rest covers client side and unreplicated edits
+	uint32 Signature = GetTypeHash(AbilitySpec.Handle);
+	Signature = HashCombine(Signature, GetTypeHash(AbilitySpec.ReplicationKey));
+	Signature = HashCombine(Signature, GetTypeHash(AbilitySpec.Level));
+	Signature = HashCombine(Signature, GetTypeHash(AbilitySpec.InputID));
+	Signature = HashCombine(Signature, PointerHash(AbilitySpec.Ability.Get()));
+	Signature = HashCombine(Signature, GetTypeHash(AbilitySpec.SourceObject));
+	for (const TPair<FGameplayTag, float>& SetByCaller : AbilitySpec.SetByCallerTagMagnitudes)
+	{
+		Signature = HashCombine(Signature, HashCombine(GetTypeHash(SetByCaller.Key), GetTypeHash(SetByCaller.Value)));
+	}
+	for (const FGameplayTag& Tag : AbilitySpec.GetDynamicSpecSourceTags())
+	{
+		Signature = HashCombine(Signature, GetTypeHash(Tag));
+	}
+	return Signature;
+}
+
+const FGameplayAbilitySpecContainer* FKaosWorldDebugger_GameplayAbilities::GetAbilityContainer(const UAbilitySystemComponent* AbilityComp)
+{
+	// The container itself is not exposed, but it is a reflected property so it can still be reached
+	static const FStructProperty* ContainerProperty = FindFProperty<FStructProperty>(UAbilitySystemComponent::StaticClass(), TEXT("ActivatableAbilities"));
+	return ContainerProperty ? ContainerProperty->ContainerPtrToValuePtr<FGameplayAbilitySpecContainer>(AbilityComp) : nullptr;
+}
+
+void FKaosWorldDebugger_GameplayAbilities::BuildAbilityRow(const FGameplayAbilitySpec& AbilitySpec, FKaosGameplayAbilityDebug& ItemData)
+{
+	ItemData.Handle = AbilitySpec.Handle;
+	ItemData.Ability = GetNameSafe(AbilitySpec.Ability);
+	ItemData.Ability.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
+	ItemData.Ability.RemoveFromEnd(TEXT("_C"));
+
+	ItemData.Source = GetNameSafe(AbilitySpec.SourceObject.Get());
+	ItemData.Source.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
+
+	ItemData.Level = AbilitySpec.Level;
+	ItemData.InputID = AbilitySpec.InputID;
+	ItemData.SetByCallerTagMagnitudes = AbilitySpec.SetByCallerTagMagnitudes;
+	ItemData.AbilityTags = AbilitySpec.GetDynamicSpecSourceTags();
+	ItemData.CooldownTags.Reset();
+	if (AbilitySpec.Ability)
 	{
-		return A.Ability < B.Ability;
-	});
-	return Abilities;
+		ItemData.AbilityTags.AppendTags(AbilitySpec.Ability->GetAssetTags());
+		if (const FGameplayTagContainer* CDTags = AbilitySpec.Ability->GetCooldownTags())
+		{
+			ItemData.CooldownTags = *CDTags;
+		}
+	}
 }
 #endif
\ No newline at end of file
@@ -22,8 +22,14 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
 #include "KaosSlateIMHelpers.h"
 
+FKaosWorldDebugger_GameplayAttributes::~FKaosWorldDebugger_GameplayAttributes()
+{
+	UnbindFromAbilitySystem();
+}
+
 void FKaosWorldDebugger_GameplayAttributes::DrawDetails(const FKaosDebuggerContext& Context)
 {
 	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
@@ -31,27 +37,33 @@ void FKaosWorldDebugger_GameplayAttributes::DrawDetails(const FKaosDebuggerConte
 	{
 		if (ContextActor != LastSelectedActor)
 		{
-			SelectedAttributeClass.Reset();
-			SelectedAttributeName.Reset();
+			SelectedAttribute.Reset();
 		}
 		LastSelectedActor = ContextActor;
-		TArray<FKaosGameplayAttributeDebug> Attributes = CollectGameplayAttributes(ASC);
-		if (Attributes.IsEmpty())
+
+		// Attribute sets can be added at runtime, that is the only time the rows need rebuilding
+		if (BoundASC != ASC || BoundAttributeSetCount != ASC->GetSpawnedAttributes().Num())
+		{
+			BindToAbilitySystem(ASC);
+		}
+
+		if (AttributeRows.IsEmpty())
 		{
 			SlateIM::Text(TEXT("No Gameplay Attributes found."));
 			return;
 		}
 		SlateIM::BeginHorizontalStack();
-		DrawWorldDebugger_Attributes(Attributes);
+		DrawWorldDebugger_Attributes();
 		SlateIM::Fill();
 		SlateIM::HAlign(HAlign_Fill);
 		SlateIM::VAlign(VAlign_Fill);
-		DrawWorldDebugger_AttributeDetails(Attributes);
+		DrawWorldDebugger_AttributeDetails(ASC);
 		SlateIM::EndHorizontalStack();
 
 	}
 	else
 	{
+		UnbindFromAbilitySystem();
 		if (ContextActor)
 		{
 			KaosSlateIM::WarningText(TEXT("No Ability System Component found."));
@@ -63,30 +75,14 @@ void FKaosWorldDebugger_GameplayAttributes::DrawDetails(const FKaosDebuggerConte
 	}
 }
 
-TArray<FKaosWorldDebugger_GameplayAttributes::FKaosGameplayAttributeDebug> FKaosWorldDebugger_GameplayAttributes::CollectGameplayAttributes(
-	const UAbilitySystemComponent* AbilityComp)
+void FKaosWorldDebugger_GameplayAttributes::BindToAbilitySystem(UAbilitySystemComponent* AbilityComp)
 {
-		TArray<FKaosGameplayAttributeDebug> DebugAttributes;
+	UnbindFromAbilitySystem();
 
-	const AActor* Actor = AbilityComp ? AbilityComp->GetOwner() : nullptr;
-	if (!Actor || !Actor->GetWorld())
-	{
-		FKaosGameplayAttributeDebug& DebugAttribute = DebugAttributes.AddDefaulted_GetRef();
-		DebugAttribute.AttributeName = TEXT("Invalid AbilitySystemComponent");
-		return DebugAttributes;
-	}
-
-	// We need to do a lot of work to detect if the AttributeSet is replicated which only occurs of AbilitySystemComponent is replicated
-	const ENetRole LocalRole = Actor->GetLocalRole();
-	const ELifetimeCondition NetCondition = Actor->AllowActorComponentToReplicate(AbilityComp);
+	BoundASC = AbilityComp;
+	BoundAttributeSetCount = AbilityComp->GetSpawnedAttributes().Num();
 
-	bool bASCReplicates = (NetCondition != ELifetimeCondition::COND_Never) && AbilityComp->IsSupportedForNetworking() && AbilityComp->IsNameStableForNetworking();
-
-	// Step 2: Collect effects by attribute
-	TMultiMap<FGameplayAttribute, FActiveGameplayEffectsContainer::DebugExecutedGameplayEffectData> EffectMap;
-	AbilityComp->GetActiveGameplayEffects().GetActiveGameplayEffectDataByAttribute(EffectMap);
-	
-	// Grab the AttributeSet rather than the Attributes themselves so we can check the network functionality
+	FKaosAbilitySystemDebugCache& DebugCache = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache();
 	for (const UAttributeSet* AttributeSet : AbilityComp->GetSpawnedAttributes())
 	{
 		const TSubclassOf<UAttributeSet> AttributeSetClass = AttributeSet ? AttributeSet->GetClass() : nullptr;
@@ -95,92 +91,149 @@ TArray<FKaosWorldDebugger_GameplayAttributes::FKaosGameplayAttributeDebug> FKaos
 			continue;
 		}
 
-		// These are all the replication conditions per variable
-		TArray<FLifetimeProperty> LifetimeProps;
-		AttributeSet->GetLifetimeReplicatedProps(LifetimeProps);
+		const FKaosAbilitySystemDebugCache::FKaosAttributeSetMetadata& Metadata = DebugCache.GetAttributeSetMetadata(AttributeSetClass);
+		for (const FKaosAbilitySystemDebugCache::FKaosAttributeMetadata& AttributeMetadata : Metadata.Attributes)
+		{
+			const FGameplayAttribute& Attrib = AttributeMetadata.Attribute;
+			FKaosGameplayAttributeRow& Row = AttributeRows.AddDefaulted_GetRef();
+			Row.Attribute = Attrib;
+			Row.AttributeName = Attrib.AttributeName;
+			Row.BaseValue = AbilityComp->GetNumericAttributeBase(Attrib);
+			Row.CurrentValue = Attrib.GetNumericValue(AttributeSet);
+			Row.AttributeSetClass = Metadata.ClassName;
+			Row.ReplicationCondition = AttributeMetadata.ReplicationCondition;
+			Row.bRepNotify = AttributeMetadata.bRepNotify;
+		}
+	}
+
+	AttributeRows.Sort([](const FKaosGameplayAttributeRow& A, const FKaosGameplayAttributeRow& B)
+	{
+		return A.AttributeName < B.AttributeName;
+	});
+
+	for (int32 Index = 0; Index < AttributeRows.Num(); ++Index)
+	{
+		FKaosGameplayAttributeRow& Row = AttributeRows[Index];
+		AttributeRowIndices.Add(Row.Attribute, Index);
+		Row.ValueChangeHandle = AbilityComp->GetGameplayAttributeValueChangeDelegate(Row.Attribute).AddRaw(this, &FKaosWorldDebugger_GameplayAttributes::OnAttributeValueChanged);
+	}
+}
+
+void FKaosWorldDebugger_GameplayAttributes::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		for (const FKaosGameplayAttributeRow& Row : AttributeRows)
+		{
+			AbilityComp->GetGameplayAttributeValueChangeDelegate(Row.Attribute).Remove(Row.ValueChangeHandle);
+		}
+	}
+
+	BoundASC.Reset();
+	BoundAttributeSetCount = 0;
+	AttributeRows.Reset();
+	AttributeRowIndices.Reset();
+}
+
+void FKaosWorldDebugger_GameplayAttributes::OnAttributeValueChanged(const FOnAttributeChangeData& ChangeData)
+{
+	const int32* RowIndex = AttributeRowIndices.Find(ChangeData.Attribute);
+	if (!RowIndex)
+	{
+		return;
+	}
 
-		// Network status can change per AttributeSet, so figure it out
-		const bool bAttributeSetReplicates = bASCReplicates && AttributeSet->IsSupportedForNetworking();
+	FKaosGameplayAttributeRow& Row = AttributeRows[*RowIndex];
+	Row.CurrentValue = ChangeData.NewValue;
+	if (const UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		Row.BaseValue = AbilityComp->GetNumericAttributeBase(ChangeData.Attribute);
+	}
+}
 
-		// Now just gather the debug data
-		TArray<FGameplayAttribute> LocalAttributes;
-		UAttributeSet::GetAttributesFromSetClass(AttributeSetClass, LocalAttributes);
-		for (const FGameplayAttribute& Attrib : LocalAttributes)
+TArray<FKaosWorldDebugger_GameplayAttributes::FKaosGameplayAttributeEffectDebugInfo> FKaosWorldDebugger_GameplayAttributes::CollectModifyingEffects(
+	const UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute) const
+{
+	TArray<FKaosGameplayAttributeEffectDebugInfo> ModifyingEffects;
+
+	// Same data GetActiveGameplayEffectDataByAttribute produces, without building it for every other attribute
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		const UGameplayEffect* Definition = ActiveGE.Spec.Def;
+		if (!Definition)
 		{
-			TArray<FKaosGameplayAttributeEffectDebugInfo> AttrDebug;
-			TArray<FActiveGameplayEffectsContainer::DebugExecutedGameplayEffectData> MatchedEffects;
-			EffectMap.MultiFind(Attrib, MatchedEffects);
+			continue;
+		}
 
-			for (const auto& DebugData : MatchedEffects)
+		for (int32 ModIdx = 0; ModIdx < ActiveGE.Spec.Modifiers.Num() && ModIdx < Definition->Modifiers.Num(); ++ModIdx)
+		{
+			const FGameplayModifierInfo& ModInfo = Definition->Modifiers[ModIdx];
+			if (ModInfo.Attribute != Attribute)
 			{
-				FString GEName = DebugData.GameplayEffectName;
-				GEName.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
-				GEName.RemoveFromEnd(TEXT("_C"));
-				AttrDebug.Add({
-					GEName,
-					DebugData.ActivationState,
-					EGameplayModOpToString(DebugData.ModifierOp),
-					DebugData.Magnitude,
-					DebugData.StackCount
-				});
+				continue;
 			}
-			
-			// Add the data to our returned array
-			FKaosGameplayAttributeDebug& DebugAttribute = DebugAttributes.Add_GetRef(
-				{
-					.AttributeName = Attrib.AttributeName,
-					.BaseValue = AbilityComp->GetNumericAttributeBase(Attrib),
-					.CurrentValue = Attrib.GetNumericValue(AttributeSet),
-					.AttributeSetClass = AttributeSetClass->GetName(),
-					.ModifyingEffects = AttrDebug
-				});
+
+			FString GEName = ActiveGE.Spec.ToSimpleString();
+			GEName.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
+			GEName.RemoveFromEnd(TEXT("_C"));
+			ModifyingEffects.Add({
+				GEName,
+				ActiveGE.bIsInhibited ? TEXT("INHIBITED") : TEXT("ACTIVE"),
+				EGameplayModOpToString(ModInfo.ModifierOp),
+				ActiveGE.Spec.GetModifierMagnitude(ModIdx, true),
+				ActiveGE.Spec.GetStackCount()
+			});
 		}
 	}
-	
-	DebugAttributes.Sort([](const FKaosGameplayAttributeDebug& A, const FKaosGameplayAttributeDebug& B)
-	{
-		return A.AttributeName < B.AttributeName;
-	});
-	return DebugAttributes;
+	return ModifyingEffects;
 }
 
-void FKaosWorldDebugger_GameplayAttributes::DrawWorldDebugger_Attributes(const TArray<FKaosGameplayAttributeDebug>& Attributes)
+FKaosWorldDebugger_GameplayAttributes::FKaosGameplayAttributeRowText FKaosWorldDebugger_GameplayAttributes::FormatAttributeRow(const FKaosGameplayAttributeRow& Row)
+{
+	FKaosGameplayAttributeRowText Text;
+	Text.BaseValue = FString::Printf(TEXT("%.2f"), Row.BaseValue);
+	Text.CurrentValue = FString::Printf(TEXT("%.2f"), Row.CurrentValue);
+	return Text;
+}
+
+void FKaosWorldDebugger_GameplayAttributes::DrawWorldDebugger_Attributes()
 {
     SlateIM::BeginTable();
     SlateIM::InitialTableColumnWidth(250.f); SlateIM::AddTableColumn(TEXT("Attribute"));
     SlateIM::InitialTableColumnWidth( 80.f);  SlateIM::AddTableColumn(TEXT("Base"));
     SlateIM::InitialTableColumnWidth( 80.f);  SlateIM::AddTableColumn(TEXT("Current"));
     SlateIM::InitialTableColumnWidth(180.f); SlateIM::AddTableColumn(TEXT("Class"));
+    SlateIM::InitialTableColumnWidth(120.f); SlateIM::AddTableColumn(TEXT("Replication"));
 
-    for (const auto& A : Attributes)
+    for (const auto& A : AttributeRows)
     {
+        const FKaosGameplayAttributeRowText Text = FormatAttributeRow(A);
         if (SlateIM::NextTableCell() && SlateIM::Button(A.AttributeName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
         {
         	SlateIM::Fill();
-            SelectedAttributeName  = A.AttributeName;
-            SelectedAttributeClass = A.AttributeSetClass;
+            SelectedAttribute = A.Attribute;
         }
-        if (SlateIM::NextTableCell()) { SlateIM::Fill(); SlateIM::Text(FString::Printf(TEXT("%.2f"), A.BaseValue)); }
-        if (SlateIM::NextTableCell()) { SlateIM::Fill(); SlateIM::Text(FString::Printf(TEXT("%.2f"), A.CurrentValue)); }
+        if (SlateIM::NextTableCell()) { SlateIM::Fill(); SlateIM::Text(Text.BaseValue); }
+        if (SlateIM::NextTableCell()) { SlateIM::Fill(); SlateIM::Text(Text.CurrentValue); }
         if (SlateIM::NextTableCell()) { SlateIM::Fill(); SlateIM::Text(A.AttributeSetClass); }
+        if (SlateIM::NextTableCell()) { SlateIM::Fill(); SlateIM::Text(A.ReplicationCondition); }
     }
     SlateIM::EndTable();
 }
 
-void FKaosWorldDebugger_GameplayAttributes::DrawWorldDebugger_AttributeDetails(const TArray<FKaosGameplayAttributeDebug>& Attributes)
+void FKaosWorldDebugger_GameplayAttributes::DrawWorldDebugger_AttributeDetails(const UAbilitySystemComponent* AbilityComp)
 {
 	SlateIM::BeginScrollBox();
 	SlateIM::BeginVerticalStack();
-	if (SelectedAttributeName.IsSet() && SelectedAttributeClass.IsSet())
+	if (SelectedAttribute.IsSet())
 	{
-		const FKaosGameplayAttributeDebug* Sel = Attributes.FindByPredicate(
-			[&](auto& X) {
-				return X.AttributeName  == SelectedAttributeName.GetValue() &&
-					   X.AttributeSetClass == SelectedAttributeClass.GetValue();
-			});
+		const int32* RowIndex = AttributeRowIndices.Find(SelectedAttribute.GetValue());
+		const FKaosGameplayAttributeRow* Sel = RowIndex ? &AttributeRows[*RowIndex] : nullptr;
 
 		if (Sel)
 		{
+			const TArray<FKaosGameplayAttributeEffectDebugInfo> ModifyingEffects = CollectModifyingEffects(AbilityComp, Sel->Attribute);
+
 			SlateIM::HAlign(HAlign_Fill);
 			SlateIM::Text(FString::Printf(TEXT("Attribute: %s"), *Sel->AttributeName));
 			SlateIM::HAlign(HAlign_Fill);
@@ -189,6 +242,22 @@ void FKaosWorldDebugger_GameplayAttributes::DrawWorldDebugger_AttributeDetails(c
 			SlateIM::Text(FString::Printf(TEXT("Current: %.2f"),Sel->CurrentValue));
 			SlateIM::HAlign(HAlign_Fill);
 			SlateIM::Text(FString::Printf(TEXT("Set Class: %s"),*Sel->AttributeSetClass));
+			SlateIM::HAlign(HAlign_Fill);
+			SlateIM::Text(FString::Printf(TEXT("Replication: %s%s"), *Sel->ReplicationCondition, Sel->bRepNotify ? TEXT(" (RepNotify)") : TEXT("")));
+			SlateIM::Spacer(FVector2D(0,4));
+			FKaosAttributeHistoryRecorder& History = FKaosGameplayDebugger_AbilitySystemModule::Get().GetAttributeHistory();
+			const bool bPinned = History.IsPinned(AbilityComp, Sel->Attribute);
+			if (SlateIM::Button(bPinned ? TEXT("Unpin from History") : TEXT("Pin to History")))
+			{
+				if (bPinned)
+				{
+					History.Unpin(AbilityComp, Sel->Attribute);
+				}
+				else
+				{
+					History.Pin(BoundASC.Get(), Sel->Attribute);
+				}
+			}
 			SlateIM::Spacer(FVector2D(0,8));
 			SlateIM::HAlign(HAlign_Fill);
 			SlateIM::Text(TEXT("Gameplay Effects:"));
@@ -196,7 +265,7 @@ void FKaosWorldDebugger_GameplayAttributes::DrawWorldDebugger_AttributeDetails(c
 			SlateIM::HAlign(HAlign_Fill);
 			SlateIM::MaxHeight(300.f); // ⬅ constrain height
 			SlateIM::BeginScrollBox(EOrientation::Orient_Vertical);
-			for (auto& E : Sel->ModifyingEffects)
+			for (auto& E : ModifyingEffects)
 			{
 				SlateIM::Padding(FMargin(6));
 				SlateIM::HAlign(HAlign_Fill);
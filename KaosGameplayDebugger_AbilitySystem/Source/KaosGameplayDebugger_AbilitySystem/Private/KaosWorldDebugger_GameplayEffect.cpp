@@ -22,40 +22,59 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
-#include "GameplayEffectExecutionCalculation.h"
-#include "GameplayModMagnitudeCalculation.h"
 #include "Algo/Compare.h"
 #include "EngineUtils.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
 #include "KaosSlateIMHelpers.h"
 
+FKaosWorldDebugger_GameplayEffects::~FKaosWorldDebugger_GameplayEffects()
+{
+	UnbindFromAbilitySystem();
+}
+
 void FKaosWorldDebugger_GameplayEffects::DrawDetails(const FKaosDebuggerContext& Context)
 {
 	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
 
 	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor))
 	{
-		TArray<FKaosGameplayEffectDebug> Effects = CollectEffectsData(ASC);
 		if (ContextActor != LastSelectedActor)
 		{
-			SelectedEffectReplicationID.Reset();
+			SelectedEffectHandle.Reset();
 		}
 		LastSelectedActor = ContextActor;
+
+		if (BoundASC != ASC)
+		{
+			BindToAbilitySystem(ASC);
+		}
+		RefreshVolatileFields(ASC);
+		SortRowsIfNeeded();
 		
-		if (Effects.IsEmpty())
+		SlateIM::BeginVerticalStack();
+		if (EffectRows.IsEmpty())
 		{
 			SlateIM::Text(TEXT("No Gameplay Effects found."));
-			return;
 		}
-		SlateIM::BeginHorizontalStack();
-		DrawWorldDebugger_Effects(Effects);
-		SlateIM::Fill();
-		SlateIM::HAlign(HAlign_Fill);
-		SlateIM::VAlign(VAlign_Fill);
-		DrawWorldDebugger_EffectDetails(Effects);
-		SlateIM::EndHorizontalStack();
+		else
+		{
+			SlateIM::Fill();
+			SlateIM::BeginHorizontalStack();
+			DrawWorldDebugger_Effects();
+			SlateIM::Fill();
+			SlateIM::HAlign(HAlign_Fill);
+			SlateIM::VAlign(VAlign_Fill);
+			DrawWorldDebugger_EffectDetails(ASC);
+			SlateIM::EndHorizontalStack();
+		}
+
+		DrawStressTest(ASC->GetWorld(), ASC);
+		SlateIM::EndVerticalStack();
 	}
 	else
 	{
+		UnbindFromAbilitySystem();
+		SlateIM::BeginVerticalStack();
 		if (ContextActor)
 		{
 			KaosSlateIM::WarningText(TEXT("No Ability System Component found."));
@@ -64,11 +83,174 @@ void FKaosWorldDebugger_GameplayEffects::DrawDetails(const FKaosDebuggerContext&
 		{
 			KaosSlateIM::ErrorText(TEXT("No Actor selected."));
 		}
+
+		// Targeting every matching owner does not need a selection
+		if (UWorld* World = ContextActor ? ContextActor->GetWorld() : Context.ContextWorld.Get())
+		{
+			DrawStressTest(World, nullptr);
+		}
+		SlateIM::EndVerticalStack();
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffects::DrawStressTest(UWorld* World, UAbilitySystemComponent* AbilityComp)
+{
+	SlateIM::CheckBox(TEXT("Show Stress Test"), bShowStressTest);
+	if (bShowStressTest || StressTest.IsRunning())
+	{
+		StressTest.Draw(World, AbilityComp);
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffects::BindToAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	UnbindFromAbilitySystem();
+
+	BoundASC = AbilityComp;
+	EffectAddedHandle = AbilityComp->OnActiveGameplayEffectAddedDelegateToSelf.AddRaw(this, &FKaosWorldDebugger_GameplayEffects::OnActiveEffectAdded);
+	EffectRemovedHandle = AbilityComp->OnAnyGameplayEffectRemovedDelegate().AddRaw(this, &FKaosWorldDebugger_GameplayEffects::OnActiveEffectRemoved);
+
+	// Seed once from the container, the delegates keep the rows current from here on
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		AddEffectRow(AbilityComp, ActiveGE);
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffects::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		AbilityComp->OnActiveGameplayEffectAddedDelegateToSelf.Remove(EffectAddedHandle);
+		AbilityComp->OnAnyGameplayEffectRemovedDelegate().Remove(EffectRemovedHandle);
+
+		for (const auto& Pair : EffectRows)
+		{
+			if (FOnActiveGameplayEffectStackChange* StackDelegate = AbilityComp->OnGameplayEffectStackChangeDelegate(Pair.Key))
+			{
+				StackDelegate->Remove(Pair.Value.StackChangeHandle);
+			}
+			if (FOnActiveGameplayEffectTimeChange* TimeDelegate = AbilityComp->OnGameplayEffectTimeChangeDelegate(Pair.Key))
+			{
+				TimeDelegate->Remove(Pair.Value.TimeChangeHandle);
+			}
+		}
+	}
+
+	BoundASC.Reset();
+	EffectAddedHandle.Reset();
+	EffectRemovedHandle.Reset();
+	EffectRows.Reset();
+	SortedHandles.Reset();
+	bSortDirty = false;
+}
+
+void FKaosWorldDebugger_GameplayEffects::AddEffectRow(UAbilitySystemComponent* AbilityComp, const FActiveGameplayEffect& ActiveGE)
+{
+	if (EffectRows.Contains(ActiveGE.Handle))
+	{
+		return;
+	}
+
+	FKaosGameplayEffectRow& Row = EffectRows.Add(ActiveGE.Handle);
+	Row.Handle = ActiveGE.Handle;
+	Row.ReplicationID = ActiveGE.ReplicationID;
+	Row.Duration = ActiveGE.GetDuration();
+	Row.Period = ActiveGE.GetPeriod();
+
+	const FGameplayEffectSpec& EffectSpec = ActiveGE.Spec;
+	Row.Effect = EffectSpec.ToSimpleString();
+	Row.Effect.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
+	Row.Effect.RemoveFromEnd(TEXT("_C"));
+	Row.Stacks = EffectSpec.GetStackCount();
+	Row.Level = EffectSpec.GetLevel();
+
+	if (FOnActiveGameplayEffectStackChange* StackDelegate = AbilityComp->OnGameplayEffectStackChangeDelegate(ActiveGE.Handle))
+	{
+		Row.StackChangeHandle = StackDelegate->AddRaw(this, &FKaosWorldDebugger_GameplayEffects::OnEffectStackChanged);
+	}
+	if (FOnActiveGameplayEffectTimeChange* TimeDelegate = AbilityComp->OnGameplayEffectTimeChangeDelegate(ActiveGE.Handle))
+	{
+		Row.TimeChangeHandle = TimeDelegate->AddRaw(this, &FKaosWorldDebugger_GameplayEffects::OnEffectTimeChanged);
+	}
+
+	SortedHandles.Add(ActiveGE.Handle);
+	bSortDirty = true;
+}
+
+void FKaosWorldDebugger_GameplayEffects::RefreshVolatileFields(const UAbilitySystemComponent* AbilityComp)
+{
+	const FActiveGameplayEffectsContainer& Container = AbilityComp->GetActiveGameplayEffects();
+	const float WorldTime = Container.GetWorldTime();
+
+	for (const FActiveGameplayEffect& ActiveGE : &Container)
+	{
+		if (FKaosGameplayEffectRow* Row = EffectRows.Find(ActiveGE.Handle))
+		{
+			Row->TimeRemaining = ActiveGE.GetTimeRemaining(WorldTime);
+			Row->bInhibited = ActiveGE.bIsInhibited;
+		}
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffects::SortRowsIfNeeded()
+{
+	if (!bSortDirty)
+	{
+		return;
+	}
+
+	SortedHandles.Sort([this](const FActiveGameplayEffectHandle& A, const FActiveGameplayEffectHandle& B)
+	{
+		return EffectRows.FindChecked(A).Effect < EffectRows.FindChecked(B).Effect;
+	});
+	bSortDirty = false;
+}
+
+void FKaosWorldDebugger_GameplayEffects::OnActiveEffectAdded(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	if (const FActiveGameplayEffect* ActiveGE = AbilityComp->GetActiveGameplayEffect(Handle))
+	{
+		AddEffectRow(AbilityComp, *ActiveGE);
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffects::OnActiveEffectRemoved(const FActiveGameplayEffect& ActiveGE)
+{
+	// The per handle delegates live on the effect itself, they go away with it
+	if (EffectRows.Remove(ActiveGE.Handle) > 0)
+	{
+		SortedHandles.RemoveSingle(ActiveGE.Handle);
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffects::OnEffectStackChanged(FActiveGameplayEffectHandle Handle, int32 NewStackCount, int32 PreviousStackCount)
+{
+	if (FKaosGameplayEffectRow* Row = EffectRows.Find(Handle))
+	{
+		Row->Stacks = NewStackCount;
 	}
 }
 
+void FKaosWorldDebugger_GameplayEffects::OnEffectTimeChanged(FActiveGameplayEffectHandle Handle, float NewStartTime, float NewDuration)
+{
+	if (FKaosGameplayEffectRow* Row = EffectRows.Find(Handle))
+	{
+		Row->Duration = NewDuration;
+	}
+}
 
-void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_Effects(const TArray<FKaosGameplayEffectDebug>& Effects)
+FKaosWorldDebugger_GameplayEffects::FKaosGameplayEffectRowText FKaosWorldDebugger_GameplayEffects::FormatEffectRow(const FKaosGameplayEffectRow& Row)
+{
+	FKaosGameplayEffectRowText Text;
+	Text.Inhibited = Row.bInhibited ? TEXT("Yes") : TEXT("No");
+	Text.Duration = Row.Duration == -1.f ? TEXT("Infinite") : FString::Printf(TEXT("%.1f"), Row.Duration);
+	Text.Remaining = Row.Duration == -1.f ? TEXT("-") : FString::Printf(TEXT("%.1f"), Row.TimeRemaining);
+	Text.Stacks = FString::FromInt(Row.Stacks);
+	return Text;
+}
+
+void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_Effects()
 {
 	SlateIM::BeginTable();
                 // Column 1: Effect Name (clickable)
@@ -77,78 +259,82 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_Effects(const TArray<
                 SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Inhibited"));
                 // Column 3: Duration
                 SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Duration"));
-                // Column 4: Stacks
+                // Column 4: Remaining
+                SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Remaining"));
+                // Column 5: Stacks
                 SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Stacks"));
 
-                for (const auto& E : Effects)
+                for (const FActiveGameplayEffectHandle& Handle : SortedHandles)
                 {
-                    const FString DurationText = E.Duration == -1.f ? "Infinite" : FString::Printf(TEXT("%.1f"), E.Duration);
-                    const FString StacksText   = FString::FromInt(E.Stacks);
-                    const FString InihibitedText       = E.bInhibited
-                                                ? TEXT("Yes")
-                                                : TEXT("No");
+                    const FKaosGameplayEffectRow& E = EffectRows.FindChecked(Handle);
+                    const FKaosGameplayEffectRowText Text = FormatEffectRow(E);
 
                     // Name cell: click to select by ReplicationID
                     if (SlateIM::NextTableCell())
                     {
                         if (SlateIM::Button(E.Effect,  &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
                         {
-                            SelectedEffectReplicationID = E.ReplicationID;
+                            SelectedEffectHandle = E.Handle;
                         }
                     }
 
-                    // InihibitedText cell
+                    // Inhibited cell
                     if (SlateIM::NextTableCell())
                     {
-                        SlateIM::Text(InihibitedText);
+                        SlateIM::Text(Text.Inhibited);
                     }
                     // Duration
                     if (SlateIM::NextTableCell())
                     {
-                        SlateIM::Text(DurationText);
+                        SlateIM::Text(Text.Duration);
+                    }
+                    // Remaining
+                    if (SlateIM::NextTableCell())
+                    {
+                        SlateIM::Text(Text.Remaining);
                     }
                     // Stacks
                     if (SlateIM::NextTableCell())
                     {
-                        SlateIM::Text(StacksText);
+                        SlateIM::Text(Text.Stacks);
                     }
                 }
             SlateIM::EndTable();
 }
 
-void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const TArray<FKaosGameplayEffectDebug>& Effects)
+void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const UAbilitySystemComponent* AbilityComp)
 {
 	
 	SlateIM::BeginVerticalStack();
-    if (SelectedEffectReplicationID.IsSet())
+    if (SelectedEffectHandle.IsSet())
     {
-        const int32 TargetID = SelectedEffectReplicationID.GetValue();
-        // Find the effect with that ReplicationID
-        const FKaosGameplayEffectDebug* Sel = Effects.FindByPredicate(
-            [&](auto& E) { return E.ReplicationID == TargetID; }
-        );
+        const FKaosGameplayEffectRow* Sel = EffectRows.Find(SelectedEffectHandle.GetValue());
+        const FActiveGameplayEffect* ActiveGE = Sel ? AbilityComp->GetActiveGameplayEffect(Sel->Handle) : nullptr;
 
-        if (Sel)
+        if (Sel && ActiveGE)
         {
+            // Heavy fields are read from the live spec, and only for the selected effect
+            const FGameplayEffectSpec& Spec = ActiveGE->Spec;
+
             // Display all your detailed fields
             SlateIM::HAlign(HAlign_Fill);
             SlateIM::Text(FString::Printf(TEXT("Effect: %s"), *Sel->Effect), &FCoreStyle::Get().GetWidgetStyle<FTextBlockStyle>("WorldBrowser.StatusBarText"));
             SlateIM::HAlign(HAlign_Fill);
-            SlateIM::Text(FString::Printf(TEXT("Context: %s"), *Sel->Context));
+            SlateIM::Text(FString::Printf(TEXT("Context: %s"), *Spec.GetContext().ToString()));
             SlateIM::HAlign(HAlign_Fill);
             SlateIM::Text(FString::Printf(TEXT("Replication ID: %d"), Sel->ReplicationID));
             SlateIM::HAlign(HAlign_Fill);
-            SlateIM::Text(FString::Printf(TEXT("Duration: %.2f   Period: %.2f"), Sel->Duration, Sel->Period));
+            SlateIM::Text(FString::Printf(TEXT("Duration: %.2f   Remaining: %.2f   Period: %.2f"), Sel->Duration, Sel->TimeRemaining, Sel->Period));
             SlateIM::HAlign(HAlign_Fill);
             SlateIM::Text(FString::Printf(TEXT("Stacks: %d   Level: %.1f"), Sel->Stacks, Sel->Level));
             SlateIM::HAlign(HAlign_Fill);
             SlateIM::Text(FString::Printf(TEXT("Inhibited: %s"), Sel->bInhibited ? TEXT("Yes") : TEXT("No")));
             SlateIM::Spacer({0,6});
-            if (Sel->SetByCallerNameMagnitudes.Num())
+            if (Spec.SetByCallerNameMagnitudes.Num())
             {
                 SlateIM::HAlign(HAlign_Fill);
                 SlateIM::Text(TEXT("SetByCaller (Name → Magnitude):"));
-                for (auto& P : Sel->SetByCallerNameMagnitudes)
+                for (auto& P : Spec.SetByCallerNameMagnitudes)
                 {
                     SlateIM::HAlign(HAlign_Fill);
                     SlateIM::Text(FString::Printf(TEXT("  %s → %.2f"), *P.Key.ToString(), P.Value));
@@ -156,11 +342,11 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 SlateIM::Spacer({0,4});
             }
 
-            if (Sel->SetByCallerTagMagnitudes.Num())
+            if (Spec.SetByCallerTagMagnitudes.Num())
             {
                 SlateIM::HAlign(HAlign_Fill);
                 SlateIM::Text(TEXT("SetByCaller (Tag → Magnitude):"));
-                for (auto& P : Sel->SetByCallerTagMagnitudes)
+                for (auto& P : Spec.SetByCallerTagMagnitudes)
                 {
                     SlateIM::HAlign(HAlign_Fill);
                     SlateIM::Text(FString::Printf(TEXT("  %s → %.2f"), *P.Key.ToString(), P.Value));
@@ -168,23 +354,23 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 SlateIM::Spacer({0,4});
             }
 
-            if (!Sel->DynamicAssetTags.IsEmpty())
+            if (!Spec.GetDynamicAssetTags().IsEmpty())
             {
                 SlateIM::HAlign(HAlign_Fill);
-                SlateIM::Text(FString::Printf(TEXT("Dynamic Asset Tags: %s"), *Sel->DynamicAssetTags.ToStringSimple()));
+                SlateIM::Text(FString::Printf(TEXT("Dynamic Asset Tags: %s"), *Spec.GetDynamicAssetTags().ToStringSimple()));
             }
-            if (!Sel->DynamicGrantedTags.IsEmpty())
+            if (!Spec.DynamicGrantedTags.IsEmpty())
             {
                 SlateIM::HAlign(HAlign_Fill);
-                SlateIM::Text(FString::Printf(TEXT("Dynamic Granted Tags: %s"), *Sel->DynamicGrantedTags.ToStringSimple()));
+                SlateIM::Text(FString::Printf(TEXT("Dynamic Granted Tags: %s"), *Spec.DynamicGrantedTags.ToStringSimple()));
             }
             SlateIM::Spacer({0,6});
 
-            if (Sel->ModifiedAttributes.Num())
+            if (Spec.ModifiedAttributes.Num())
             {
                 SlateIM::HAlign(HAlign_Fill);
                 SlateIM::Text(TEXT("Modified Attributes:"));
-                for (auto& MA : Sel->ModifiedAttributes)
+                for (auto& MA : Spec.ModifiedAttributes)
                 {
                     SlateIM::HAlign(HAlign_Fill);
                     SlateIM::Text(FString::Printf(TEXT("  %s → %.2f"), *MA.Attribute.GetName(), MA.TotalMagnitude));
@@ -192,7 +378,7 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 SlateIM::Spacer({0,6});
             }
 
-            if (Sel->Definition.IsValid())
+            if (Spec.Def)
             {
                 SlateIM::HAlign(HAlign_Fill);
                 SlateIM::Text(TEXT("Definition Details (CDO):"));
@@ -203,35 +389,24 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 SlateIM::BeginVerticalStack();
                 SlateIM::HAlign(HAlign_Fill);
                 SlateIM::VAlign(VAlign_Fill);
-                if (!Sel->Definition->Modifiers.IsEmpty())
+                // The definition never changes at runtime, so draw from the cached summary
+                const FKaosAbilitySystemDebugCache::FKaosEffectDefinitionSummary& Summary = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache().GetEffectDefinitionSummary(Spec.Def);
+                if (!Summary.Modifiers.IsEmpty())
                 {
                 	SlateIM::HAlign(HAlign_Fill);
                 	SlateIM::Text(TEXT("Modifiers:"), &FCoreStyle::Get().GetWidgetStyle<FTextBlockStyle>("WorldBrowser.StatusBarText"));
-                	for (const auto& Modifier : Sel->Definition->Modifiers)
+                	for (const auto& Modifier : Summary.Modifiers)
                 	{
-                		// 1) Attribute name
-                		const FString AttrName = Modifier.Attribute.AttributeName;
                 		SlateIM::HAlign(HAlign_Fill);
-                		SlateIM::Text(FString::Printf(TEXT("• %s"), *AttrName));
-
-                		// 2) Magnitude calculation type
-                		const auto CalcType = Modifier.ModifierMagnitude.GetMagnitudeCalculationType();
-                		const FString CalcTypeName = StaticEnum<EGameplayEffectMagnitudeCalculation>()
-							->GetNameStringByValue((int64)CalcType);
+                		SlateIM::Text(FString::Printf(TEXT("• %s"), *Modifier.Attribute));
                 		SlateIM::HAlign(HAlign_Fill);
-                		SlateIM::Text(FString::Printf(TEXT("    Calc Type: %s"), *CalcTypeName));
-
-                		// 3) Custom calculation class (if any)
-                		const UClass* CustomClass = Modifier.ModifierMagnitude.GetCustomMagnitudeCalculationClass();
-                		const FString CustomClassName = CustomClass 
-							? CustomClass->GetName() 
-							: TEXT("None");
+                		SlateIM::Text(FString::Printf(TEXT("    Calc Type: %s"), *Modifier.CalcType));
                 		SlateIM::HAlign(HAlign_Fill);
-                		SlateIM::Text(FString::Printf(TEXT("    Custom Class: %s"), *CustomClassName));
+                		SlateIM::Text(FString::Printf(TEXT("    Custom Class: %s"), *Modifier.CustomClass));
 
-                		// 4) Static magnitude (if available)
+                		// Static magnitude depends on the level of this spec, so it is still evaluated here
                 		float StaticMag = 0.f;
-                		if (Modifier.ModifierMagnitude.GetStaticMagnitudeIfPossible(Sel->Level, StaticMag))
+                		if (Modifier.Magnitude.GetStaticMagnitudeIfPossible(Sel->Level, StaticMag))
                 		{
                 			SlateIM::HAlign(HAlign_Fill);
                 			SlateIM::Text(FString::Printf(TEXT("    Static Magnitude: %.2f"), StaticMag));
@@ -242,27 +417,23 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 		SlateIM::Spacer(FVector2D(0, 6));
                 	}
                 }
-                if (!Sel->Definition->Executions.IsEmpty())
+                if (!Summary.Executions.IsEmpty())
                 {
                 	SlateIM::HAlign(HAlign_Fill);
                 	SlateIM::Text(TEXT("Executions:"), &FCoreStyle::Get().GetWidgetStyle<FTextBlockStyle>("WorldBrowser.StatusBarText"));
-                	for (const auto& Exec : Sel->Definition->Executions)
+                	for (const auto& Exec : Summary.Executions)
                 	{
-                		const FString ExecClass = GetNameSafe(Exec.CalculationClass);
                 		SlateIM::HAlign(HAlign_Fill);
-                		SlateIM::Text(FString::Printf(TEXT("• %s"), *ExecClass));
-
-                		const auto PassedInTags = Exec.PassedInTags.ToStringSimple();
+                		SlateIM::Text(FString::Printf(TEXT("• %s"), *Exec.CalculationClass));
                 		SlateIM::HAlign(HAlign_Fill);
-                		SlateIM::Text(FString::Printf(TEXT("    Passed In Tag: %s"), *PassedInTags));
+                		SlateIM::Text(FString::Printf(TEXT("    Passed In Tag: %s"), *Exec.PassedInTags));
 
-                		if (!Exec.ConditionalGameplayEffects.IsEmpty())
+                		if (!Exec.ConditionalEffects.IsEmpty())
                 		{
                 			SlateIM::HAlign(HAlign_Fill);
                 			SlateIM::Text(TEXT("    Conditional Effects:"));
-                			for (const auto& CGE : Exec.ConditionalGameplayEffects)
+                			for (const FString& CGEName : Exec.ConditionalEffects)
                 			{
-                				const FString CGEName = GetNameSafe(CGE.EffectClass);
                 				SlateIM::Text(FString::Printf(TEXT("        %s"), *CGEName));
                 			}
                 		}
@@ -270,12 +441,10 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 		{
                 			SlateIM::HAlign(HAlign_Fill);
                 			SlateIM::Text(TEXT("    Calculation Modifiers:"));
-                			for (const auto& Modifier : Exec.CalculationModifiers)
+                			for (const FString& CaptureStr : Exec.CalculationModifiers)
                 			{
-                				const FString CaptureStr = Modifier.CapturedAttribute.ToSimpleString();
                 				SlateIM::HAlign(HAlign_Fill);
                 				SlateIM::Text(FString::Printf(TEXT("        %s"), *CaptureStr));
-                				//Modifier.ModifierMagnitude.GetValueForEditorDisplay()
                 			}
                 		}
                 	
@@ -285,27 +454,27 @@ void FKaosWorldDebugger_GameplayEffects::DrawWorldDebugger_EffectDetails(const T
                 	}
                 }
                 SlateIM::HAlign(HAlign_Fill);
-                SlateIM::Text(FString::Printf(TEXT("Stacking Type: %s"), *StaticEnum<EGameplayEffectStackingType>()->GetNameStringByValue((int64)Sel->Definition->StackingType)), &FCoreStyle::Get().GetWidgetStyle<FTextBlockStyle>("WorldBrowser.StatusBarText"));
-                if (Sel->Definition->StackingType > EGameplayEffectStackingType::None)
+                SlateIM::Text(FString::Printf(TEXT("Stacking Type: %s"), *Summary.StackingType), &FCoreStyle::Get().GetWidgetStyle<FTextBlockStyle>("WorldBrowser.StatusBarText"));
+                if (Summary.bStacks)
                 {
                 	SlateIM::HAlign(HAlign_Fill);
-                	SlateIM::Text(FString::Printf(TEXT("Stacking Limit: %d"), Sel->Definition->StackLimitCount));
+                	SlateIM::Text(FString::Printf(TEXT("Stacking Limit: %d"), Summary.StackLimitCount));
                 	SlateIM::HAlign(HAlign_Fill);
-                	SlateIM::Text(FString::Printf(TEXT("Duration Refresh Policy: %s"),  *StaticEnum<EGameplayEffectStackingDurationPolicy>()->GetNameStringByValue((int64)Sel->Definition->StackDurationRefreshPolicy)));
+                	SlateIM::Text(FString::Printf(TEXT("Duration Refresh Policy: %s"), *Summary.StackDurationRefreshPolicy));
                 	SlateIM::HAlign(HAlign_Fill);
-                	SlateIM::Text(FString::Printf(TEXT("Stack Expiration Policy: %s"),  *StaticEnum<EGameplayEffectStackingExpirationPolicy>()->GetNameStringByValue((int64)Sel->Definition->StackExpirationPolicy)));
+                	SlateIM::Text(FString::Printf(TEXT("Stack Expiration Policy: %s"), *Summary.StackExpirationPolicy));
                 	SlateIM::HAlign(HAlign_Fill);
-                	SlateIM::Text(FString::Printf(TEXT("Stack Period Reset Policy: %s"),  *StaticEnum<EGameplayEffectStackingPeriodPolicy>()->GetNameStringByValue((int64)Sel->Definition->StackPeriodResetPolicy)));
+                	SlateIM::Text(FString::Printf(TEXT("Stack Period Reset Policy: %s"), *Summary.StackPeriodResetPolicy));
                 }
-                if (!Sel->Definition->GetGrantedTags().IsEmpty())
+                if (!Summary.GrantedTags.IsEmpty())
                 {
                 	SlateIM::HAlign(HAlign_Fill);
-                	SlateIM::Text(FString::Printf(TEXT("Granted to Target Tags: %s"), *Sel->Definition->GetGrantedTags().ToStringSimple()));
+                	SlateIM::Text(FString::Printf(TEXT("Granted to Target Tags: %s"), *Summary.GrantedTags));
                 }
-                if (!Sel->Definition->GetAssetTags().IsEmpty())
+                if (!Summary.AssetTags.IsEmpty())
                 {
                 	SlateIM::HAlign(HAlign_Fill);
-                	SlateIM::Text(FString::Printf(TEXT("Asset Tags: %s"), *Sel->Definition->GetAssetTags().ToStringSimple()));
+                	SlateIM::Text(FString::Printf(TEXT("Asset Tags: %s"), *Summary.AssetTags));
                 }
                 SlateIM::EndVerticalStack();
                 SlateIM::EndScrollBox();
@@ -329,40 +498,4 @@ FSlateIcon FKaosWorldDebugger_GameplayEffects::GetTabIcon() const
 
 	return MyIcon;
 }
-
-
-TArray<FKaosWorldDebugger_GameplayEffects::FKaosGameplayEffectDebug> FKaosWorldDebugger_GameplayEffects::CollectEffectsData(const UAbilitySystemComponent* AbilityComp) const
-{
-	TArray<FKaosGameplayEffectDebug> DebugEffects;
-
-	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
-	{
-		FKaosGameplayEffectDebug& ItemData = DebugEffects.AddDefaulted_GetRef();
-		ItemData.ReplicationID = ActiveGE.ReplicationID;
-		ItemData.bInhibited = ActiveGE.bIsInhibited;
-		ItemData.Duration = ActiveGE.GetDuration();
-		ItemData.Period = ActiveGE.GetPeriod();
-
-		const FGameplayEffectSpec& EffectSpec = ActiveGE.Spec;
-		ItemData.Effect = EffectSpec.ToSimpleString();
-		ItemData.Effect.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
-		ItemData.Effect.RemoveFromEnd(TEXT("_C"));
-
-		ItemData.Context = EffectSpec.GetContext().ToString();
-		ItemData.Stacks = EffectSpec.GetStackCount();
-		ItemData.Level = EffectSpec.GetLevel();
-		ItemData.DynamicGrantedTags = EffectSpec.DynamicGrantedTags;
-		ItemData.DynamicAssetTags = EffectSpec.GetDynamicAssetTags();
-		ItemData.ModifiedAttributes = EffectSpec.ModifiedAttributes;
-		ItemData.SetByCallerTagMagnitudes = EffectSpec.SetByCallerTagMagnitudes;
-		ItemData.SetByCallerNameMagnitudes = EffectSpec.SetByCallerNameMagnitudes;
-		ItemData.Definition = EffectSpec.Def;
-	}
-
-	DebugEffects.Sort([](const FKaosGameplayEffectDebug& A, const FKaosGameplayEffectDebug& B)
-	{
-		return A.Effect < B.Effect;
-	});
-	return DebugEffects;
-}
 #endif
\ No newline at end of file
@@ -0,0 +1,255 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_GameplayEffectCensus.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_GameplayEffectCensus::FKaosWorldDebugger_GameplayEffectCensus()
+	: Census(
+		&FKaosWorldDebugger_GameplayEffectCensus::ProcessAbilitySystem,
+		[](FKaosEffectCensusResult& Result)
+		{
+			// Infinite effects first, they are the ones that leak
+			Result.Classes.Sort([](const FKaosEffectClassCensus& A, const FKaosEffectClassCensus& B)
+			{
+				return A.Infinite != B.Infinite ? A.Infinite > B.Infinite : A.Instances > B.Instances;
+			});
+			for (FKaosEffectClassCensus& ClassCensus : Result.Classes)
+			{
+				ClassCensus.Owners.Sort([](const FKaosEffectOwnerCensus& A, const FKaosEffectOwnerCensus& B)
+				{
+					return A.Instances > B.Instances;
+				});
+			}
+			Result.ClassIndices.Reset();
+		})
+{
+}
+
+void FKaosWorldDebugger_GameplayEffectCensus::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	TickCensus(World, Context.DeltaTime);
+	const FKaosEffectCensusResult& Result = Census.GetResults();
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	Census.DrawControls();
+
+	if (!Census.HasResults())
+	{
+		SlateIM::Text(TEXT("Waiting for first census pass..."));
+		SlateIM::EndVerticalStack();
+		SlateIM::EndScrollBox();
+		return;
+	}
+
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(Result.TotalComponents));
+	KaosSlateIM::DrawLabledText(TEXT("Active Gameplay Effects"), FString::FromInt(Result.TotalEffects));
+	KaosSlateIM::DrawLabledText(TEXT("Infinite Duration"), FString::FromInt(Result.TotalInfinite));
+
+	KaosSlateIM::HeaderText(TEXT("Effect Classes"));
+	DrawClassTable(Result);
+
+	if (SelectedEffectName.IsSet())
+	{
+		const FKaosEffectClassCensus* Selected = Result.Classes.FindByPredicate([this](const FKaosEffectClassCensus& ClassCensus)
+		{
+			return ClassCensus.EffectName == SelectedEffectName.GetValue();
+		});
+
+		KaosSlateIM::HeaderText(SelectedEffectName.GetValue());
+		if (Selected)
+		{
+			DrawOwnerTable(*Selected);
+		}
+		else
+		{
+			KaosSlateIM::WarningText(TEXT("No longer active in this world."));
+		}
+	}
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+void FKaosWorldDebugger_GameplayEffectCensus::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		return;
+	}
+
+	TickCensus(World, Context.DeltaTime);
+	if (!Census.HasResults())
+	{
+		return;
+	}
+
+	const FKaosEffectCensusResult& Result = Census.GetResults();
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Ability System Components"), FString::FromInt(Result.TotalComponents)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Active Gameplay Effects"), FString::FromInt(Result.TotalEffects)));
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Infinite Duration"), FString::FromInt(Result.TotalInfinite)));
+	for (const FKaosEffectClassCensus& ClassCensus : Result.Classes)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(ClassCensus.EffectName, FString::Printf(TEXT("%d instances, %d stacks, %d periodic, %d infinite on %d owners"),
+			ClassCensus.Instances, ClassCensus.TotalStacks, ClassCensus.Periodic, ClassCensus.Infinite, ClassCensus.Owners.Num())));
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffectCensus::TickCensus(UWorld* World, float DeltaTime)
+{
+	if (CensusWorld != World)
+	{
+		CensusWorld = World;
+		SelectedEffectName.Reset();
+	}
+
+	Census.Tick(World, DeltaTime);
+}
+
+void FKaosWorldDebugger_GameplayEffectCensus::ProcessAbilitySystem(const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC, FKaosEffectCensusResult& Result)
+{
+	const UAbilitySystemComponent* AbilityComp = WeakASC.Get();
+	if (!IsValid(AbilityComp))
+	{
+		return;
+	}
+
+	++Result.TotalComponents;
+	const FString OwnerName = GetNameSafe(AbilityComp->GetOwnerActor());
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		const UGameplayEffect* Definition = ActiveGE.Spec.Def;
+		UClass* EffectClass = Definition ? Definition->GetClass() : nullptr;
+
+		int32& ClassIndex = Result.ClassIndices.FindOrAdd(EffectClass, INDEX_NONE);
+		if (ClassIndex == INDEX_NONE)
+		{
+			ClassIndex = Result.Classes.AddDefaulted();
+			FString EffectName = GetNameSafe(EffectClass);
+			EffectName.RemoveFromEnd(TEXT("_C"));
+			Result.Classes[ClassIndex].EffectName = EffectName;
+		}
+
+		const int32 Stacks = ActiveGE.Spec.GetStackCount();
+		const bool bInfinite = ActiveGE.GetDuration() == FGameplayEffectConstants::INFINITE_DURATION;
+
+		FKaosEffectClassCensus& ClassCensus = Result.Classes[ClassIndex];
+		++ClassCensus.Instances;
+		ClassCensus.TotalStacks += Stacks;
+		ClassCensus.Periodic += ActiveGE.GetPeriod() > 0.f ? 1 : 0;
+		ClassCensus.Infinite += bInfinite ? 1 : 0;
+		ClassCensus.Inhibited += ActiveGE.bIsInhibited ? 1 : 0;
+
+		// Effects on one ASC are visited together, so the owner is always the last entry if it exists
+		if (ClassCensus.Owners.IsEmpty() || ClassCensus.Owners.Last().OwnerName != OwnerName)
+		{
+			ClassCensus.Owners.AddDefaulted_GetRef().OwnerName = OwnerName;
+		}
+		++ClassCensus.Owners.Last().Instances;
+		ClassCensus.Owners.Last().Stacks += Stacks;
+
+		++Result.TotalEffects;
+		Result.TotalInfinite += bInfinite ? 1 : 0;
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffectCensus::DrawClassTable(const FKaosEffectCensusResult& Result)
+{
+	SlateIM::MaxHeight(500.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(240.f); SlateIM::AddTableColumn(TEXT("Effect"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Instances"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Stacks"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Periodic"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Infinite"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Inhibited"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Owners"));
+
+	for (const FKaosEffectClassCensus& ClassCensus : Result.Classes)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			if (SlateIM::Button(ClassCensus.EffectName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+			{
+				SelectedEffectName = ClassCensus.EffectName;
+			}
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassCensus.Instances));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassCensus.TotalStacks));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassCensus.Periodic));
+		if (SlateIM::NextTableCell())
+		{
+			if (ClassCensus.Infinite > 0)
+			{
+				SlateIM::Text(FString::FromInt(ClassCensus.Infinite), FLinearColor::Yellow);
+			}
+			else
+			{
+				SlateIM::Text(TEXT("0"));
+			}
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassCensus.Inhibited));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassCensus.Owners.Num()));
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_GameplayEffectCensus::DrawOwnerTable(const FKaosEffectClassCensus& ClassCensus)
+{
+	SlateIM::MaxHeight(300.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(240.f); SlateIM::AddTableColumn(TEXT("Owner"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Instances"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Stacks"));
+
+	for (const FKaosEffectOwnerCensus& Owner : ClassCensus.Owners)
+	{
+		if (SlateIM::NextTableCell()) SlateIM::Text(Owner.OwnerName);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Owner.Instances));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Owner.Stacks));
+	}
+	SlateIM::EndTable();
+}
+
+FSlateIcon FKaosWorldDebugger_GameplayEffectCensus::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "ClassIcon.GameStateBase");
+
+	return MyIcon;
+}
+#endif
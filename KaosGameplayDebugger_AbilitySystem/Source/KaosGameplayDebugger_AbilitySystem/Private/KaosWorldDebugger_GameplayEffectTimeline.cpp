@@ -0,0 +1,428 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_GameplayEffectTimeline.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_GameplayEffectTimeline::FKaosWorldDebugger_GameplayEffectTimeline()
+	: Events(MaxEvents)
+{
+}
+
+FKaosWorldDebugger_GameplayEffectTimeline::~FKaosWorldDebugger_GameplayEffectTimeline()
+{
+	UnbindFromAbilitySystem();
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	if (ContextActor && ContextActor != RecordedActor.Get())
+	{
+		UnbindFromAbilitySystem();
+		ResetHistory();
+		RecordedActor = ContextActor;
+	}
+
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor);
+	if (ASC && BoundASC != ASC)
+	{
+		BindToAbilitySystem(ASC);
+	}
+	else if (!BoundASC.IsValid() && !BoundASC.IsExplicitlyNull())
+	{
+		// The ASC was destroyed under us, close whatever was still running and keep the history
+		UnbindFromAbilitySystem();
+	}
+	LastWorldTime = GetWorldTime();
+
+	if (!BoundASC.IsValid())
+	{
+		if (Events.IsEmpty())
+		{
+			if (ContextActor)
+			{
+				KaosSlateIM::WarningText(TEXT("No Ability System Component found."));
+			}
+			else
+			{
+				KaosSlateIM::ErrorText(TEXT("No Actor selected."));
+			}
+			return;
+		}
+		KaosSlateIM::WarningText(TEXT("Ability System Component is gone, history is frozen."));
+	}
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Window (s)"));
+	SlateIM::MinWidth(80.f);
+	SlateIM::SpinBox(WindowSeconds, 1.f, 600.f);
+	SlateIM::Spacer(FVector2D(12, 0));
+	const bool bWasPaused = bPaused;
+	SlateIM::CheckBox(TEXT("Pause"), bPaused);
+	if (bPaused && !bWasPaused)
+	{
+		PausedTime = GetWorldTime();
+	}
+	SlateIM::Spacer(FVector2D(12, 0));
+	if (SlateIM::Button(TEXT("Clear")))
+	{
+		Events.Reset();
+	}
+	SlateIM::EndHorizontalStack();
+
+	KaosSlateIM::DrawLabledText(TEXT("Events"), FString::Printf(TEXT("%d / %d (%.1f KB)"), Events.Num(), Events.Capacity(), Events.GetAllocatedSize() / 1024.0));
+	if (Events.IsFull())
+	{
+		KaosSlateIM::DrawLabledText(TEXT("Oldest Event"), FString::Printf(TEXT("%.1fs ago"), GetWorldTime() - Events[0].Time));
+	}
+
+	// Pausing only freezes the view, recording carries on underneath
+	const double EndTime = bPaused ? PausedTime : GetWorldTime();
+	const double StartTime = EndTime - WindowSeconds;
+	TArray<FKaosEffectLane> Lanes;
+	BuildLanes(StartTime, EndTime, Lanes);
+
+	if (Lanes.IsEmpty())
+	{
+		SlateIM::Text(TEXT("No Gameplay Effect activity in this window."));
+		return;
+	}
+
+	DrawTimeline(Lanes, StartTime, EndTime);
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::BindToAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	UnbindFromAbilitySystem();
+
+	BoundASC = AbilityComp;
+	EffectAddedHandle = AbilityComp->OnActiveGameplayEffectAddedDelegateToSelf.AddRaw(this, &FKaosWorldDebugger_GameplayEffectTimeline::OnActiveEffectAdded);
+	EffectRemovedHandle = AbilityComp->OnAnyGameplayEffectRemovedDelegate().AddRaw(this, &FKaosWorldDebugger_GameplayEffectTimeline::OnActiveEffectRemoved);
+	PeriodicExecuteHandle = AbilityComp->OnPeriodicGameplayEffectExecuteDelegateOnSelf.AddRaw(this, &FKaosWorldDebugger_GameplayEffectTimeline::OnPeriodicEffectExecuted);
+
+	// Effects that were already running start at the bind time, nothing older was observed
+	const double Now = GetWorldTime();
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		TrackEffect(AbilityComp, ActiveGE, Now);
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		AbilityComp->OnActiveGameplayEffectAddedDelegateToSelf.Remove(EffectAddedHandle);
+		AbilityComp->OnAnyGameplayEffectRemovedDelegate().Remove(EffectRemovedHandle);
+		AbilityComp->OnPeriodicGameplayEffectExecuteDelegateOnSelf.Remove(PeriodicExecuteHandle);
+
+		for (const auto& Pair : TrackedEffects)
+		{
+			if (FOnActiveGameplayEffectStackChange* StackDelegate = AbilityComp->OnGameplayEffectStackChangeDelegate(Pair.Key))
+			{
+				StackDelegate->Remove(Pair.Value.StackChangeHandle);
+			}
+			if (FOnActiveGameplayEffectTimeChange* TimeDelegate = AbilityComp->OnGameplayEffectTimeChangeDelegate(Pair.Key))
+			{
+				TimeDelegate->Remove(Pair.Value.TimeChangeHandle);
+			}
+		}
+	}
+
+	// Nothing will report these any more, end their lanes here rather than leave them running forever
+	TArray<FActiveGameplayEffectHandle> OpenHandles;
+	TrackedEffects.GetKeys(OpenHandles);
+	for (const FActiveGameplayEffectHandle& Handle : OpenHandles)
+	{
+		RecordEvent(Handle, EKaosEffectTimelineEvent::Removed);
+	}
+
+	BoundASC.Reset();
+	EffectAddedHandle.Reset();
+	EffectRemovedHandle.Reset();
+	PeriodicExecuteHandle.Reset();
+	TrackedEffects.Reset();
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::ResetHistory()
+{
+	Events.Reset();
+	bPaused = false;
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::TrackEffect(UAbilitySystemComponent* AbilityComp, const FActiveGameplayEffect& ActiveGE, double Time)
+{
+	if (TrackedEffects.Contains(ActiveGE.Handle))
+	{
+		return;
+	}
+
+	FString EffectName = GetNameSafe(ActiveGE.Spec.Def);
+	EffectName.RemoveFromStart(DEFAULT_OBJECT_PREFIX);
+	EffectName.RemoveFromEnd(TEXT("_C"));
+
+	FKaosTrackedEffect& Tracked = TrackedEffects.Add(ActiveGE.Handle);
+	Tracked.EffectName = FName(EffectName);
+	Tracked.AppliedTime = Time;
+	Tracked.StackCount = ActiveGE.Spec.GetStackCount();
+	if (FOnActiveGameplayEffectStackChange* StackDelegate = AbilityComp->OnGameplayEffectStackChangeDelegate(ActiveGE.Handle))
+	{
+		Tracked.StackChangeHandle = StackDelegate->AddRaw(this, &FKaosWorldDebugger_GameplayEffectTimeline::OnEffectStackChanged);
+	}
+	if (FOnActiveGameplayEffectTimeChange* TimeDelegate = AbilityComp->OnGameplayEffectTimeChangeDelegate(ActiveGE.Handle))
+	{
+		Tracked.TimeChangeHandle = TimeDelegate->AddRaw(this, &FKaosWorldDebugger_GameplayEffectTimeline::OnEffectTimeChanged);
+	}
+
+	RecordEvent(ActiveGE.Handle, EKaosEffectTimelineEvent::Applied);
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::RecordEvent(FActiveGameplayEffectHandle Handle, EKaosEffectTimelineEvent Type, int32 PreviousStackCount)
+{
+	const FKaosTrackedEffect* Tracked = TrackedEffects.Find(Handle);
+	if (!Tracked)
+	{
+		return;
+	}
+
+	FKaosEffectTimelineEvent Event;
+	Event.Time = Type == EKaosEffectTimelineEvent::Applied ? Tracked->AppliedTime : GetWorldTime();
+	Event.Handle = Handle;
+	Event.EffectName = Tracked->EffectName;
+	Event.Type = Type;
+	Event.AppliedTime = Tracked->AppliedTime;
+	Event.StackCount = Tracked->StackCount;
+	Event.PreviousStackCount = PreviousStackCount == INDEX_NONE ? Tracked->StackCount : PreviousStackCount;
+	Events.Push(Event);
+}
+
+double FKaosWorldDebugger_GameplayEffectTimeline::GetWorldTime() const
+{
+	const UAbilitySystemComponent* AbilityComp = BoundASC.Get();
+	const UWorld* World = AbilityComp ? AbilityComp->GetWorld() : nullptr;
+	return World ? World->GetTimeSeconds() : LastWorldTime;
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::OnActiveEffectAdded(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	if (const FActiveGameplayEffect* ActiveGE = AbilityComp->GetActiveGameplayEffect(Handle))
+	{
+		TrackEffect(AbilityComp, *ActiveGE, GetWorldTime());
+	}
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::OnActiveEffectRemoved(const FActiveGameplayEffect& ActiveGE)
+{
+	RecordEvent(ActiveGE.Handle, EKaosEffectTimelineEvent::Removed);
+
+	// The per handle delegates live on the effect itself, they go away with it
+	TrackedEffects.Remove(ActiveGE.Handle);
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::OnPeriodicEffectExecuted(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	RecordEvent(Handle, EKaosEffectTimelineEvent::Periodic);
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::OnEffectStackChanged(FActiveGameplayEffectHandle Handle, int32 NewStackCount, int32 PreviousStackCount)
+{
+	if (FKaosTrackedEffect* Tracked = TrackedEffects.Find(Handle))
+	{
+		Tracked->StackCount = NewStackCount;
+	}
+	RecordEvent(Handle, EKaosEffectTimelineEvent::Stacked, PreviousStackCount);
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::OnEffectTimeChanged(FActiveGameplayEffectHandle Handle, float NewStartTime, float NewDuration)
+{
+	RecordEvent(Handle, EKaosEffectTimelineEvent::Refreshed);
+}
+
+int32 FKaosWorldDebugger_GameplayEffectTimeline::FindFirstEventAfter(double Time) const
+{
+	// Events are recorded in time order, so the window start is a binary search away
+	int32 First = 0;
+	int32 Last = Events.Num();
+	while (First < Last)
+	{
+		const int32 Mid = First + (Last - First) / 2;
+		if (Events[Mid].Time < Time)
+		{
+			First = Mid + 1;
+		}
+		else
+		{
+			Last = Mid;
+		}
+	}
+	return First;
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::BuildLanes(double StartTime, double EndTime, TArray<FKaosEffectLane>& OutLanes) const
+{
+	TMap<FActiveGameplayEffectHandle, int32> LaneIndices;
+	auto FindOrAddLane = [&](FActiveGameplayEffectHandle Handle, FName EffectName, int32 StackCount) -> FKaosEffectLane&
+	{
+		if (const int32* LaneIndex = LaneIndices.Find(Handle))
+		{
+			return OutLanes[*LaneIndex];
+		}
+
+		// Anything first seen part way through the window was already running when it opened, with the stacks it had then
+		LaneIndices.Add(Handle, OutLanes.Num());
+		FKaosEffectLane& Lane = OutLanes.AddDefaulted_GetRef();
+		Lane.Handle = Handle;
+		Lane.EffectName = EffectName;
+		Lane.Begin = StartTime;
+		Lane.End = EndTime;
+		Lane.MaxStacks = FMath::Max(StackCount, 1);
+		return Lane;
+	};
+
+	int32 Index = FindFirstEventAfter(StartTime);
+	for (; Index < Events.Num() && Events[Index].Time <= EndTime; ++Index)
+	{
+		const FKaosEffectTimelineEvent& Event = Events[Index];
+		FKaosEffectLane& Lane = FindOrAddLane(Event.Handle, Event.EffectName, Event.PreviousStackCount);
+		switch (Event.Type)
+		{
+		case EKaosEffectTimelineEvent::Applied:
+			Lane.Begin = Event.Time;
+			Lane.MaxStacks = FMath::Max(Lane.MaxStacks, Event.StackCount);
+			break;
+		case EKaosEffectTimelineEvent::Refreshed:
+			++Lane.Refreshes;
+			Lane.Markers.Emplace(Event.Time, Event.Type);
+			break;
+		case EKaosEffectTimelineEvent::Stacked:
+			Lane.MaxStacks = FMath::Max(Lane.MaxStacks, Event.StackCount);
+			Lane.Markers.Emplace(Event.Time, Event.Type);
+			break;
+		case EKaosEffectTimelineEvent::Periodic:
+			++Lane.PeriodicExecutions;
+			Lane.Markers.Emplace(Event.Time, Event.Type);
+			break;
+		case EKaosEffectTimelineEvent::Removed:
+			Lane.End = Event.Time;
+			Lane.bOpen = false;
+			break;
+		}
+	}
+
+	// Long running effects may have no events inside the window at all. While paused, one that has been
+	// removed since is only found through its later events, the first of which still knows its stacks back then
+	for (; Index < Events.Num(); ++Index)
+	{
+		const FKaosEffectTimelineEvent& Event = Events[Index];
+		if (Event.AppliedTime <= EndTime && !LaneIndices.Contains(Event.Handle))
+		{
+			FindOrAddLane(Event.Handle, Event.EffectName, Event.PreviousStackCount);
+		}
+	}
+	for (const auto& Pair : TrackedEffects)
+	{
+		if (Pair.Value.AppliedTime <= EndTime && !LaneIndices.Contains(Pair.Key))
+		{
+			FindOrAddLane(Pair.Key, Pair.Value.EffectName, Pair.Value.StackCount);
+		}
+	}
+
+	OutLanes.StableSort([](const FKaosEffectLane& A, const FKaosEffectLane& B)
+	{
+		return A.Begin < B.Begin;
+	});
+}
+
+void FKaosWorldDebugger_GameplayEffectTimeline::DrawTimeline(const TArray<FKaosEffectLane>& Lanes, double StartTime, double EndTime) const
+{
+	static const FLinearColor RefreshColor(1.f, 1.f, 1.f);
+	static const FLinearColor StackColor(1.f, 0.8f, 0.2f);
+	static const FLinearColor PeriodicColor(1.f, 0.3f, 0.3f);
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::Text(TEXT("Refreshed"), RefreshColor);
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::Text(TEXT("Stacked"), StackColor);
+	SlateIM::Spacer(FVector2D(12, 0));
+	SlateIM::Text(TEXT("Periodic"), PeriodicColor);
+	SlateIM::EndHorizontalStack();
+
+	// X is seconds relative to the end of the window, every lane sits on its own row
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::MinHeight(FMath::Clamp(Lanes.Num() * 14.f, 80.f, 400.f));
+	SlateIM::BeginGraph();
+	SlateIM::GraphLine({ FVector2D(StartTime - EndTime, 0.5), FVector2D(0.0, 0.5) }, FLinearColor::Transparent, 1.f);
+	SlateIM::GraphLine({ FVector2D(StartTime - EndTime, -Lanes.Num() + 0.5), FVector2D(0.0, -Lanes.Num() + 0.5) }, FLinearColor::Transparent, 1.f);
+	for (int32 LaneIndex = 0; LaneIndex < Lanes.Num(); ++LaneIndex)
+	{
+		const FKaosEffectLane& Lane = Lanes[LaneIndex];
+		const double Row = -LaneIndex;
+		const FLinearColor LaneColor = FLinearColor::MakeFromHSV8(static_cast<uint8>(GetTypeHash(Lane.EffectName) & 0xFF), 160, 230);
+		SlateIM::GraphLine({ FVector2D(Lane.Begin - EndTime, Row), FVector2D(Lane.End - EndTime, Row) }, LaneColor, 6.f);
+
+		for (const TPair<double, EKaosEffectTimelineEvent>& Marker : Lane.Markers)
+		{
+			const FLinearColor& MarkerColor = Marker.Value == EKaosEffectTimelineEvent::Periodic ? PeriodicColor
+				: Marker.Value == EKaosEffectTimelineEvent::Stacked ? StackColor : RefreshColor;
+			SlateIM::GraphLine({ FVector2D(Marker.Key - EndTime, Row - 0.35), FVector2D(Marker.Key - EndTime, Row + 0.35) }, MarkerColor, 1.5f);
+		}
+	}
+	SlateIM::EndGraph();
+
+	SlateIM::Spacer(FVector2D(0, 6));
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(40.f);  SlateIM::AddTableColumn(TEXT("Row"));
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Effect"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Start"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("End"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Stacks"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Refreshes"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Periodic"));
+	for (int32 LaneIndex = 0; LaneIndex < Lanes.Num(); ++LaneIndex)
+	{
+		const FKaosEffectLane& Lane = Lanes[LaneIndex];
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(LaneIndex));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Lane.EffectName.ToString());
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%.1fs"), Lane.Begin - EndTime));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Lane.bOpen ? FString(TEXT("Active")) : FString::Printf(TEXT("%.1fs"), Lane.End - EndTime));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Lane.MaxStacks));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Lane.Refreshes));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Lane.PeriodicExecutions));
+	}
+	SlateIM::EndTable();
+	SlateIM::EndScrollBox();
+}
+
+FSlateIcon FKaosWorldDebugger_GameplayEffectTimeline::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Sequencer.Tracks.Event");
+
+	return MyIcon;
+}
+#endif
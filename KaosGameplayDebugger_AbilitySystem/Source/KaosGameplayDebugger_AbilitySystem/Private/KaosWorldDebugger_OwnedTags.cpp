@@ -0,0 +1,301 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_OwnedTags.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/World.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_OwnedTags::~FKaosWorldDebugger_OwnedTags()
+{
+	UnbindFromAbilitySystem();
+}
+
+void FKaosWorldDebugger_OwnedTags::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor))
+	{
+		if (BoundASC != ASC)
+		{
+			BindToAbilitySystem(ASC);
+		}
+
+		if (bSourcesDirty)
+		{
+			UpdateSources(ASC);
+		}
+
+		SlateIM::BeginHorizontalStack();
+		SlateIM::VAlign(VAlign_Center);
+		SlateIM::Text(FString::Printf(TEXT("%d Owned Tags (%s)"), ASC->GetOwnedGameplayTags().Num(), ASC->IsOwnerActorAuthoritative() ? TEXT("Authority") : TEXT("Client")));
+		SlateIM::Spacer(FVector2D(12, 0));
+		if (SlateIM::CheckBox(TEXT("Show Removed"), bShowRemoved))
+		{
+			bSortDirty = true;
+		}
+		SlateIM::EndHorizontalStack();
+
+		if (Rows.IsEmpty())
+		{
+			KaosSlateIM::WarningText(TEXT("The Ability System Component owns no Gameplay Tags."));
+			return;
+		}
+
+		DrawTagTable();
+	}
+	else
+	{
+		UnbindFromAbilitySystem();
+		if (ContextActor)
+		{
+			KaosSlateIM::WarningText(TEXT("No Ability System Component found."));
+		}
+		else
+		{
+			KaosSlateIM::ErrorText(TEXT("No Actor selected."));
+		}
+	}
+}
+
+void FKaosWorldDebugger_OwnedTags::BindToAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	UnbindFromAbilitySystem();
+
+	BoundASC = AbilityComp;
+	GenericTagEventHandle = AbilityComp->RegisterGenericGameplayTagEvent().AddRaw(this, &FKaosWorldDebugger_OwnedTags::OnTagAddedOrRemoved);
+
+	for (const FGameplayTag& Tag : AbilityComp->GetOwnedGameplayTags())
+	{
+		TrackTag(AbilityComp, Tag);
+	}
+}
+
+void FKaosWorldDebugger_OwnedTags::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		AbilityComp->RegisterGenericGameplayTagEvent().Remove(GenericTagEventHandle);
+		for (const auto& Pair : Rows)
+		{
+			AbilityComp->RegisterGameplayTagEvent(Pair.Key, EGameplayTagEventType::AnyCountChange).Remove(Pair.Value.CountChangedHandle);
+		}
+	}
+
+	BoundASC.Reset();
+	GenericTagEventHandle.Reset();
+	Rows.Reset();
+	SortedTags.Reset();
+	bSourcesDirty = false;
+	bSortDirty = false;
+}
+
+void FKaosWorldDebugger_OwnedTags::TrackTag(UAbilitySystemComponent* AbilityComp, const FGameplayTag& Tag)
+{
+	FKaosOwnedTagRow& Row = Rows.FindOrAdd(Tag);
+	if (!Row.CountChangedHandle.IsValid())
+	{
+		// The generic event only reports a tag appearing or disappearing, stack changes need the per tag event
+		Row.CountChangedHandle = AbilityComp->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::AnyCountChange).AddRaw(this, &FKaosWorldDebugger_OwnedTags::OnTagCountChanged);
+		bSortDirty = true;
+	}
+
+	RecordCount(Row, AbilityComp->GetTagCount(Tag));
+}
+
+double FKaosWorldDebugger_OwnedTags::GetWorldTime() const
+{
+	const UAbilitySystemComponent* AbilityComp = BoundASC.Get();
+	const UWorld* World = AbilityComp ? AbilityComp->GetWorld() : nullptr;
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void FKaosWorldDebugger_OwnedTags::OnTagAddedOrRemoved(const FGameplayTag Tag, int32 NewCount)
+{
+	UAbilitySystemComponent* AbilityComp = BoundASC.Get();
+	if (!AbilityComp)
+	{
+		return;
+	}
+
+	// Parent tags are reported too, only explicitly owned tags get a row
+	if (NewCount > 0 && AbilityComp->GetOwnedGameplayTags().HasTagExact(Tag))
+	{
+		TrackTag(AbilityComp, Tag);
+	}
+	else if (FKaosOwnedTagRow* Row = Rows.Find(Tag))
+	{
+		RecordCount(*Row, NewCount);
+	}
+}
+
+void FKaosWorldDebugger_OwnedTags::OnTagCountChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	if (FKaosOwnedTagRow* Row = Rows.Find(Tag))
+	{
+		RecordCount(*Row, NewCount);
+	}
+}
+
+void FKaosWorldDebugger_OwnedTags::RecordCount(FKaosOwnedTagRow& Row, int32 NewCount)
+{
+	if (Row.History.IsEmpty() || Row.History.Last().Count != NewCount)
+	{
+		Row.History.Push({ GetWorldTime(), NewCount });
+	}
+
+	bSortDirty |= (Row.Count == 0) != (NewCount == 0);
+	Row.Count = NewCount;
+	bSourcesDirty = true;
+}
+
+void FKaosWorldDebugger_OwnedTags::UpdateSources(const UAbilitySystemComponent* AbilityComp)
+{
+	for (auto& Pair : Rows)
+	{
+		Pair.Value.FromEffects = 0;
+		Pair.Value.ReplicatedLoose = 0;
+		Pair.Value.MinimalReplication = 0;
+	}
+
+	// Each uninhibited active effect adds its granted tags once, regardless of its stack count
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		if (ActiveGE.bIsInhibited || !ActiveGE.Spec.Def)
+		{
+			continue;
+		}
+
+		FGameplayTagContainer GrantedTags = ActiveGE.Spec.Def->GetGrantedTags();
+		GrantedTags.AppendTags(ActiveGE.Spec.DynamicGrantedTags);
+		for (const FGameplayTag& Tag : GrantedTags)
+		{
+			if (FKaosOwnedTagRow* Row = Rows.Find(Tag))
+			{
+				++Row->FromEffects;
+			}
+		}
+	}
+
+	for (const TPair<FGameplayTag, int32>& Pair : AbilityComp->GetReplicatedLooseTags().TagMap)
+	{
+		if (FKaosOwnedTagRow* Row = Rows.Find(Pair.Key))
+		{
+			Row->ReplicatedLoose = Pair.Value;
+		}
+	}
+
+	for (const TPair<FGameplayTag, int32>& Pair : AbilityComp->GetMinimalReplicationTags().TagMap)
+	{
+		if (FKaosOwnedTagRow* Row = Rows.Find(Pair.Key))
+		{
+			Row->MinimalReplication = Pair.Value;
+		}
+	}
+
+	// The authority mirrors its effect tags into the minimal map, clients apply received minimal tags as loose counts
+	const bool bMinimalIsLoose = !AbilityComp->IsOwnerActorAuthoritative();
+	for (auto& Pair : Rows)
+	{
+		FKaosOwnedTagRow& Row = Pair.Value;
+		Row.Loose = FMath::Max(Row.Count - Row.FromEffects - Row.ReplicatedLoose - (bMinimalIsLoose ? Row.MinimalReplication : 0), 0);
+	}
+
+	bSourcesDirty = false;
+	bSortDirty = true;
+}
+
+void FKaosWorldDebugger_OwnedTags::DrawTagTable()
+{
+	if (bSortDirty)
+	{
+		SortedTags.Reset(Rows.Num());
+		for (const auto& Pair : Rows)
+		{
+			if (bShowRemoved || Pair.Value.Count > 0)
+			{
+				SortedTags.Add(Pair.Key);
+			}
+		}
+
+		// Group by the source contributing most of the count, then by name
+		auto PrimarySource = [this](const FGameplayTag& Tag)
+		{
+			const FKaosOwnedTagRow& Row = Rows.FindChecked(Tag);
+			if (Row.Count == 0) return 4;
+			if (Row.FromEffects > 0) return 0;
+			if (Row.ReplicatedLoose > 0) return 1;
+			if (Row.MinimalReplication > 0) return 2;
+			return 3;
+		};
+		SortedTags.Sort([&PrimarySource](const FGameplayTag& A, const FGameplayTag& B)
+		{
+			const int32 SourceA = PrimarySource(A);
+			const int32 SourceB = PrimarySource(B);
+			return SourceA != SourceB ? SourceA < SourceB : A.ToString() < B.ToString();
+		});
+		bSortDirty = false;
+	}
+
+	const double Now = GetWorldTime();
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Tag"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Count"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Effects"));
+	SlateIM::InitialTableColumnWidth(90.f);  SlateIM::AddTableColumn(TEXT("Rep. Loose"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Minimal"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Loose"));
+	SlateIM::InitialTableColumnWidth(320.f); SlateIM::AddTableColumn(TEXT("History"));
+
+	for (const FGameplayTag& Tag : SortedTags)
+	{
+		const FKaosOwnedTagRow& Row = Rows.FindChecked(Tag);
+
+		FString History;
+		for (int32 Index = Row.History.Num() - 1; Index >= 0; --Index)
+		{
+			const FKaosTagCountChange& Change = Row.History[Index];
+			History += FString::Printf(TEXT("%s%d @-%.1fs"), History.IsEmpty() ? TEXT("") : TEXT(", "), Change.Count, Now - Change.Time);
+		}
+
+		if (SlateIM::NextTableCell()) SlateIM::Text(Tag.ToString(), Row.Count > 0 ? FLinearColor::White : FLinearColor::Gray);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Row.Count));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Row.FromEffects));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Row.ReplicatedLoose));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Row.MinimalReplication));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Row.Loose));
+		if (SlateIM::NextTableCell()) SlateIM::Text(History);
+	}
+	SlateIM::EndTable();
+}
+
+FSlateIcon FKaosWorldDebugger_OwnedTags::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "GraphEditor.Tag_16x");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,296 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_PredictionTracker.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Abilities/GameplayAbility.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_PredictionTracker::~FKaosWorldDebugger_PredictionTracker()
+{
+	UnbindFromAbilitySystem();
+}
+
+void FKaosWorldDebugger_PredictionTracker::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	if (UAbilitySystemComponent* ASC = FindLocallyControlledAbilitySystem(Context))
+	{
+		if (BoundASC != ASC)
+		{
+			BindToAbilitySystem(ASC);
+		}
+
+		SlateIM::BeginHorizontalStack();
+		SlateIM::VAlign(VAlign_Center);
+		SlateIM::Text(FString::Printf(TEXT("Tracking %s"), *GetNameSafe(ASC->GetOwnerActor())));
+		SlateIM::Spacer(FVector2D(12, 0));
+		if (SlateIM::Button(TEXT("Reset")))
+		{
+			ResetStats();
+		}
+		SlateIM::EndHorizontalStack();
+
+		if (ASC->IsOwnerActorAuthoritative())
+		{
+			KaosSlateIM::WarningText(TEXT("The locally controlled ASC has authority, nothing is predicted."));
+			return;
+		}
+
+		KaosSlateIM::DrawLabledText(TEXT("In Flight Keys"), FString::Printf(TEXT("%d (oldest %.0f ms)"), KeyTracker.Num(), KeyTracker.GetOldestAge() * 1000.0));
+		if (KeyTracker.GetDroppedKeys() > 0)
+		{
+			KaosSlateIM::DrawLabledText(TEXT("Dropped Keys"), FString::FromInt(KeyTracker.GetDroppedKeys()), FLinearColor::Yellow);
+		}
+
+		if (PredictionStats.IsEmpty())
+		{
+			KaosSlateIM::WarningText(TEXT("No prediction keys issued since tracking started."));
+			return;
+		}
+
+		SlateIM::BeginHorizontalStack();
+		DrawPredictionTable();
+		SlateIM::Fill();
+		SlateIM::HAlign(HAlign_Fill);
+		SlateIM::VAlign(VAlign_Fill);
+		DrawPredictionDetails();
+		SlateIM::EndHorizontalStack();
+	}
+	else
+	{
+		UnbindFromAbilitySystem();
+		KaosSlateIM::WarningText(TEXT("No locally controlled Ability System Component found."));
+	}
+}
+
+UAbilitySystemComponent* FKaosWorldDebugger_PredictionTracker::FindLocallyControlledAbilitySystem(const FKaosDebuggerContext& Context)
+{
+	// Prefer the selected actor when it is the one being predicted
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor))
+	{
+		if (ASC->AbilityActorInfo.IsValid() && ASC->AbilityActorInfo->IsLocallyControlled())
+		{
+			return ASC;
+		}
+	}
+
+	UWorld* World = ContextActor ? ContextActor->GetWorld() : Context.ContextWorld.Get();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* Controller = It->Get();
+		if (!Controller || !Controller->IsLocalController())
+		{
+			continue;
+		}
+
+		if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Controller->GetPawn()))
+		{
+			return ASC;
+		}
+
+		if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Controller->PlayerState))
+		{
+			return ASC;
+		}
+	}
+
+	return nullptr;
+}
+
+void FKaosWorldDebugger_PredictionTracker::BindToAbilitySystem(UAbilitySystemComponent* AbilityComp)
+{
+	UnbindFromAbilitySystem();
+
+	BoundASC = AbilityComp;
+	ActivatedHandle = AbilityComp->AbilityActivatedCallbacks.AddRaw(this, &FKaosWorldDebugger_PredictionTracker::OnAbilityActivated);
+	EffectAddedHandle = AbilityComp->OnActiveGameplayEffectAddedDelegateToSelf.AddRaw(this, &FKaosWorldDebugger_PredictionTracker::OnEffectAdded);
+	KeyTracker.OnCaughtUp.BindRaw(this, &FKaosWorldDebugger_PredictionTracker::OnKeyCaughtUp);
+	KeyTracker.OnRejected.BindRaw(this, &FKaosWorldDebugger_PredictionTracker::OnKeyRejected);
+}
+
+void FKaosWorldDebugger_PredictionTracker::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilityComp = BoundASC.Get())
+	{
+		AbilityComp->AbilityActivatedCallbacks.Remove(ActivatedHandle);
+		AbilityComp->OnActiveGameplayEffectAddedDelegateToSelf.Remove(EffectAddedHandle);
+	}
+
+	BoundASC.Reset();
+	ActivatedHandle.Reset();
+	EffectAddedHandle.Reset();
+	ResetStats();
+}
+
+void FKaosWorldDebugger_PredictionTracker::ResetStats()
+{
+	// Keys predicted before this may still resolve, they must not land in the new stats
+	KeyTracker.Reset();
+	PredictionStats.Reset();
+	RecentRollbacks.Reset();
+	SelectedAbilityClass.Reset();
+}
+
+FKaosInFlightPredictionKey* FKaosWorldDebugger_PredictionTracker::TrackKey(FPredictionKey PredictionKey, const UGameplayAbility* Ability)
+{
+	bool bAdded = false;
+	FKaosInFlightPredictionKey* InFlight = KeyTracker.Track(PredictionKey, Ability, bAdded);
+	if (bAdded)
+	{
+		UClass* AbilityClass = InFlight->AbilityClass.Get();
+		FKaosPredictionStats* Stats = PredictionStats.Find(AbilityClass);
+		if (!Stats)
+		{
+			Stats = &PredictionStats.Add(AbilityClass);
+			Stats->AbilityName = AbilityClass ? AbilityClass->GetName() : TEXT("(No Ability)");
+		}
+		++Stats->Issued;
+	}
+	return InFlight;
+}
+
+void FKaosWorldDebugger_PredictionTracker::OnAbilityActivated(UGameplayAbility* Ability)
+{
+	const FGameplayAbilityActivationInfo& ActivationInfo = Ability->GetCurrentActivationInfo();
+	if (ActivationInfo.ActivationMode == EGameplayAbilityActivationMode::Predicting)
+	{
+		TrackKey(ActivationInfo.GetActivationPredictionKey(), Ability);
+	}
+}
+
+void FKaosWorldDebugger_PredictionTracker::OnEffectAdded(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	const FActiveGameplayEffect* ActiveGE = AbilityComp->GetActiveGameplayEffect(Handle);
+	if (!ActiveGE)
+	{
+		return;
+	}
+
+	// Effects predicted outside of a tracked activation still get a key of their own
+	if (FKaosInFlightPredictionKey* InFlight = TrackKey(ActiveGE->PredictionKey, nullptr))
+	{
+		++InFlight->PredictedEffects;
+		if (FKaosPredictionStats* Stats = PredictionStats.Find(InFlight->AbilityClass))
+		{
+			++Stats->PredictedEffects;
+		}
+	}
+}
+
+void FKaosWorldDebugger_PredictionTracker::OnKeyCaughtUp(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight)
+{
+	if (FKaosPredictionStats* Stats = PredictionStats.Find(InFlight.AbilityClass))
+	{
+		++Stats->Confirmed;
+		Stats->IssueToConfirm.Add(FPlatformTime::Seconds() - InFlight.IssuedTime);
+	}
+}
+
+void FKaosWorldDebugger_PredictionTracker::OnKeyRejected(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (FKaosPredictionStats* Stats = PredictionStats.Find(InFlight.AbilityClass))
+	{
+		++Stats->Rejected;
+		Stats->RolledBackEffects += InFlight.PredictedEffects;
+		Stats->IssueToReject.Add(Now - InFlight.IssuedTime);
+		RecentRollbacks.Push({ Now, PredictionKey, Stats->AbilityName, InFlight.PredictedEffects });
+	}
+}
+
+void FKaosWorldDebugger_PredictionTracker::DrawPredictionTable()
+{
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Ability"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Issued"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Confirmed"));
+	SlateIM::InitialTableColumnWidth(70.f);  SlateIM::AddTableColumn(TEXT("Rejected"));
+	SlateIM::InitialTableColumnWidth(110.f); SlateIM::AddTableColumn(TEXT("Effects Rolled Back"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Confirm p50 ms"));
+
+	for (const auto& Pair : PredictionStats)
+	{
+		const FKaosPredictionStats& Stats = Pair.Value;
+		if (SlateIM::NextTableCell() && SlateIM::Button(Stats.AbilityName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+		{
+			SelectedAbilityClass = Pair.Key;
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Stats.Issued));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Stats.Confirmed));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(Stats.Rejected), Stats.Rejected > 0 ? FLinearColor::Yellow : FLinearColor::White);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%d / %d"), Stats.RolledBackEffects, Stats.PredictedEffects));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Stats.IssueToConfirm.GetCount() > 0 ? FString::Printf(TEXT("%.1f"), Stats.IssueToConfirm.GetPercentile(0.5) * 1000.0) : FString(TEXT("-")));
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_PredictionTracker::DrawPredictionDetails()
+{
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+	const FKaosPredictionStats* Sel = SelectedAbilityClass.IsSet() ? PredictionStats.Find(SelectedAbilityClass.GetValue()) : nullptr;
+	if (Sel)
+	{
+		KaosSlateIM::HeaderText(Sel->AbilityName);
+		KaosSlateIM::DrawLabledText(TEXT("Issued / Confirmed / Rejected"), FString::Printf(TEXT("%d / %d / %d"), Sel->Issued, Sel->Confirmed, Sel->Rejected));
+		KaosSlateIM::DrawLabledText(TEXT("Rollback Rate"), Sel->Issued > 0 ? FString::Printf(TEXT("%.1f%%"), 100.f * Sel->Rejected / Sel->Issued) : FString(TEXT("-")));
+		KaosSlateIM::DrawLabledText(TEXT("Predicted / Rolled Back Effects"), FString::Printf(TEXT("%d / %d"), Sel->PredictedEffects, Sel->RolledBackEffects));
+
+		KaosSlateIM::DrawHistogram(TEXT("Issue to Confirm"), Sel->IssueToConfirm);
+		KaosSlateIM::DrawHistogram(TEXT("Issue to Reject"), Sel->IssueToReject);
+	}
+	else
+	{
+		KaosSlateIM::WarningText(TEXT("Click an abilities name on the left to view its histograms here."));
+	}
+
+	if (!RecentRollbacks.IsEmpty())
+	{
+		const double Now = FPlatformTime::Seconds();
+		SlateIM::Spacer(FVector2D(0, 8));
+		KaosSlateIM::SubHeaderText(TEXT("Recent Rollbacks"));
+		for (int32 Index = RecentRollbacks.Num() - 1; Index >= 0; --Index)
+		{
+			const FKaosRollback& Rollback = RecentRollbacks[Index];
+			KaosSlateIM::DrawLabledText(FString::Printf(TEXT("%.1fs ago"), Now - Rollback.Time), FString::Printf(TEXT("%s key %d, %d effects"), *Rollback.AbilityName, Rollback.Key, Rollback.Effects));
+		}
+	}
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+FSlateIcon FKaosWorldDebugger_PredictionTracker::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Refresh");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,249 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_ReplicationFootprint.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/World.h"
+#include "KaosGameplayDebugger_AbilitySystem.h"
+#include "KaosSlateIMHelpers.h"
+
+namespace KaosReplicationFootprint
+{
+	// Rough serialized sizes, enough to rank owners against each other, not to predict bandwidth exactly
+	static constexpr int32 FastArrayItemHeaderBytes = 4;
+	static constexpr int32 EffectItemBytes = 40;
+	static constexpr int32 EffectModifierBytes = 4;
+	static constexpr int32 AbilityItemBytes = 24;
+	static constexpr int32 AttributeBytes = 8;
+	static constexpr int32 TagBytes = 3;
+}
+
+FKaosWorldDebugger_ReplicationFootprint::FKaosWorldDebugger_ReplicationFootprint()
+	: Rollup(
+		&FKaosWorldDebugger_ReplicationFootprint::ProcessAbilitySystem,
+		[](FKaosFootprintRollup& Result)
+		{
+			Result.OwnerClasses.Sort([](const FKaosOwnerClassFootprint& A, const FKaosOwnerClassFootprint& B)
+			{
+				return A.ProxyBytes > B.ProxyBytes;
+			});
+			Result.ClassIndices.Reset();
+		})
+{
+}
+
+void FKaosWorldDebugger_ReplicationFootprint::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	AActor* ContextActor = Cast<AActor>(Context.ContextObject.Get());
+	UWorld* World = ContextActor ? ContextActor->GetWorld() : Context.ContextWorld.Get();
+	Rollup.Tick(World, Context.DeltaTime);
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	if (const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(ContextActor))
+	{
+		DrawSelectedFootprint(ASC);
+	}
+	else if (ContextActor)
+	{
+		KaosSlateIM::WarningText(TEXT("No Ability System Component found."));
+	}
+	else
+	{
+		KaosSlateIM::ErrorText(TEXT("No Actor selected."));
+	}
+
+	DrawRollup();
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+TOptional<EGameplayEffectReplicationMode> FKaosWorldDebugger_ReplicationFootprint::GetReplicationMode(const UAbilitySystemComponent* AbilityComp)
+{
+	// There is a setter but no getter, the property is reflected though
+	static const FEnumProperty* ModeProperty = FindFProperty<FEnumProperty>(UAbilitySystemComponent::StaticClass(), TEXT("ReplicationMode"));
+	if (!ModeProperty)
+	{
+		return {};
+	}
+
+	const int64 Value = ModeProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ModeProperty->ContainerPtrToValuePtr<void>(AbilityComp));
+	return static_cast<EGameplayEffectReplicationMode>(Value);
+}
+
+FKaosWorldDebugger_ReplicationFootprint::FKaosReplicationFootprint FKaosWorldDebugger_ReplicationFootprint::ComputeFootprint(const UAbilitySystemComponent* AbilityComp)
+{
+	using namespace KaosReplicationFootprint;
+
+	FKaosReplicationFootprint Footprint;
+	Footprint.ReplicationMode = GetReplicationMode(AbilityComp);
+	Footprint.ActivatableAbilities = AbilityComp->GetActivatableAbilities().Num();
+	Footprint.ReplicatedLooseTags = AbilityComp->GetReplicatedLooseTags().TagMap.Num();
+	Footprint.MinimalReplicationTags = AbilityComp->GetMinimalReplicationTags().TagMap.Num();
+
+	for (const FActiveGameplayEffect& ActiveGE : &AbilityComp->GetActiveGameplayEffects())
+	{
+		++Footprint.ActiveEffects;
+		Footprint.EffectModifiers += ActiveGE.Spec.Modifiers.Num();
+		Footprint.EffectGrantedTags += ActiveGE.Spec.Def ? ActiveGE.Spec.Def->GetGrantedTags().Num() : 0;
+	}
+
+	FKaosAbilitySystemDebugCache& DebugCache = FKaosGameplayDebugger_AbilitySystemModule::Get().GetDebugCache();
+	for (const UAttributeSet* AttributeSet : AbilityComp->GetSpawnedAttributes())
+	{
+		if (!AttributeSet)
+		{
+			continue;
+		}
+
+		++Footprint.AttributeSets;
+		for (const FKaosAbilitySystemDebugCache::FKaosAttributeMetadata& Attribute : DebugCache.GetAttributeSetMetadata(AttributeSet->GetClass()).Attributes)
+		{
+			Footprint.ReplicatedAttributes += Attribute.bReplicated ? 1 : 0;
+		}
+	}
+
+	// Full sends effects to everyone, Mixed only to the owner and Minimal to no one, proxies get minimal tags instead
+	const EGameplayEffectReplicationMode Mode = Footprint.ReplicationMode.Get(EGameplayEffectReplicationMode::Full);
+	const int32 EffectBytes = Footprint.ActiveEffects * (FastArrayItemHeaderBytes + EffectItemBytes) + Footprint.EffectModifiers * EffectModifierBytes;
+	const int32 AbilityBytes = Footprint.ActivatableAbilities * (FastArrayItemHeaderBytes + AbilityItemBytes);
+	const int32 SharedBytes = Footprint.ReplicatedAttributes * AttributeBytes + Footprint.ReplicatedLooseTags * TagBytes;
+	const int32 MinimalBytes = Footprint.MinimalReplicationTags * TagBytes;
+
+	Footprint.OwnerBytes = SharedBytes + AbilityBytes + (Mode == EGameplayEffectReplicationMode::Minimal ? MinimalBytes : EffectBytes);
+	Footprint.ProxyBytes = SharedBytes + (Mode == EGameplayEffectReplicationMode::Full ? EffectBytes : MinimalBytes);
+
+	// Under Full the minimal tag map is not maintained, the tags granted by effects stand in for it
+	Footprint.ProxyBytesIfMinimal = SharedBytes + FMath::Max(Footprint.MinimalReplicationTags, Footprint.EffectGrantedTags) * TagBytes;
+
+	// A single effect changing re-sends its item to proxies under Full, otherwise only the tags it grants may change
+	const int32 AverageEffectBytes = Footprint.ActiveEffects > 0 ? EffectBytes / Footprint.ActiveEffects : FastArrayItemHeaderBytes + EffectItemBytes;
+	const int32 AverageGrantedTagBytes = Footprint.ActiveEffects > 0 ? Footprint.EffectGrantedTags * TagBytes / Footprint.ActiveEffects : 0;
+	Footprint.EffectDeltaBytes = Mode == EGameplayEffectReplicationMode::Full ? AverageEffectBytes : FMath::Max(AverageGrantedTagBytes, TagBytes);
+	return Footprint;
+}
+
+void FKaosWorldDebugger_ReplicationFootprint::ProcessAbilitySystem(const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC, FKaosFootprintRollup& Result)
+{
+	const UAbilitySystemComponent* AbilityComp = WeakASC.Get();
+	if (!IsValid(AbilityComp))
+	{
+		return;
+	}
+
+	const AActor* Owner = AbilityComp->GetOwnerActor();
+	UClass* OwnerClass = Owner ? Owner->GetClass() : nullptr;
+	int32& ClassIndex = Result.ClassIndices.FindOrAdd(OwnerClass, INDEX_NONE);
+	if (ClassIndex == INDEX_NONE)
+	{
+		ClassIndex = Result.OwnerClasses.AddDefaulted();
+		Result.OwnerClasses[ClassIndex].OwnerClassName = GetNameSafe(OwnerClass);
+	}
+
+	const FKaosReplicationFootprint Footprint = ComputeFootprint(AbilityComp);
+
+	FKaosOwnerClassFootprint& ClassFootprint = Result.OwnerClasses[ClassIndex];
+	++ClassFootprint.Components;
+	ClassFootprint.FullReplication += Footprint.ReplicationMode == EGameplayEffectReplicationMode::Full ? 1 : 0;
+	ClassFootprint.ActiveEffects += Footprint.ActiveEffects;
+	ClassFootprint.ActivatableAbilities += Footprint.ActivatableAbilities;
+	ClassFootprint.ProxyBytes += Footprint.ProxyBytes;
+	ClassFootprint.ProxyBytesIfMinimal += Footprint.ProxyBytesIfMinimal;
+
+	++Result.TotalComponents;
+	Result.TotalProxyBytes += Footprint.ProxyBytes;
+}
+
+void FKaosWorldDebugger_ReplicationFootprint::DrawSelectedFootprint(const UAbilitySystemComponent* AbilityComp)
+{
+	const FKaosReplicationFootprint Footprint = ComputeFootprint(AbilityComp);
+	const UEnum* ModeEnum = StaticEnum<EGameplayEffectReplicationMode>();
+
+	KaosSlateIM::HeaderText(GetNameSafe(AbilityComp->GetOwnerActor()));
+	KaosSlateIM::DrawLabledText(TEXT("Replication Mode"), Footprint.ReplicationMode.IsSet() ? ModeEnum->GetNameStringByValue(static_cast<int64>(Footprint.ReplicationMode.GetValue())) : FString(TEXT("Unknown")));
+	KaosSlateIM::DrawLabledText(TEXT("Active Effects (fast array)"), FString::Printf(TEXT("%d items, %d modifiers"), Footprint.ActiveEffects, Footprint.EffectModifiers));
+	KaosSlateIM::DrawLabledText(TEXT("Activatable Abilities (fast array)"), FString::FromInt(Footprint.ActivatableAbilities));
+	KaosSlateIM::DrawLabledText(TEXT("Replicated Loose Tags"), FString::FromInt(Footprint.ReplicatedLooseTags));
+	KaosSlateIM::DrawLabledText(TEXT("Minimal Replication Tags"), FString::FromInt(Footprint.MinimalReplicationTags));
+	KaosSlateIM::DrawLabledText(TEXT("Attribute Sets"), FString::FromInt(Footprint.AttributeSets));
+	KaosSlateIM::DrawLabledText(TEXT("Replicated Attributes"), FString::FromInt(Footprint.ReplicatedAttributes));
+
+	SlateIM::Spacer(FVector2D(0, 8));
+	KaosSlateIM::SubHeaderText(TEXT("Estimated Size"));
+	KaosSlateIM::DrawLabledText(TEXT("Full State to Owner"), FString::Printf(TEXT("%d bytes"), Footprint.OwnerBytes));
+	KaosSlateIM::DrawLabledText(TEXT("Full State to Each Proxy"), FString::Printf(TEXT("%d bytes"), Footprint.ProxyBytes));
+	KaosSlateIM::DrawLabledText(TEXT("To Each Proxy under Minimal"), FString::Printf(TEXT("%d bytes"), Footprint.ProxyBytesIfMinimal));
+	KaosSlateIM::DrawLabledText(TEXT("Delta per Effect Change"), FString::Printf(TEXT("%d bytes"), Footprint.EffectDeltaBytes));
+}
+
+void FKaosWorldDebugger_ReplicationFootprint::DrawRollup()
+{
+	SlateIM::Spacer(FVector2D(0, 8));
+	KaosSlateIM::HeaderText(TEXT("World Roll-up by Owner Class"));
+
+	Rollup.DrawControls();
+
+	if (!Rollup.HasResults())
+	{
+		SlateIM::Text(TEXT("Waiting for first pass..."));
+		return;
+	}
+
+	const FKaosFootprintRollup& Result = Rollup.GetResults();
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(Result.TotalComponents));
+	KaosSlateIM::DrawLabledText(TEXT("Full State to Each Proxy"), FString::Printf(TEXT("%.1f KB"), Result.TotalProxyBytes / 1024.0));
+
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(220.f); SlateIM::AddTableColumn(TEXT("Owner Class"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Count"));
+	SlateIM::InitialTableColumnWidth(60.f);  SlateIM::AddTableColumn(TEXT("Full"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Effects"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Abilities"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Proxy Bytes"));
+	SlateIM::InitialTableColumnWidth(120.f); SlateIM::AddTableColumn(TEXT("Saved by Minimal"));
+
+	for (const FKaosOwnerClassFootprint& ClassFootprint : Result.OwnerClasses)
+	{
+		const int64 Saving = ClassFootprint.ProxyBytes - ClassFootprint.ProxyBytesIfMinimal;
+		if (SlateIM::NextTableCell()) SlateIM::Text(ClassFootprint.OwnerClassName);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassFootprint.Components));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassFootprint.FullReplication), ClassFootprint.FullReplication > 0 ? FLinearColor::Yellow : FLinearColor::White);
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassFootprint.ActiveEffects));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::FromInt(ClassFootprint.ActivatableAbilities));
+		if (SlateIM::NextTableCell()) SlateIM::Text(FString::Printf(TEXT("%lld"), ClassFootprint.ProxyBytes));
+		if (SlateIM::NextTableCell()) SlateIM::Text(Saving > 0 ? FString::Printf(TEXT("%lld"), Saving) : FString(TEXT("-")));
+	}
+	SlateIM::EndTable();
+}
+
+FSlateIcon FKaosWorldDebugger_ReplicationFootprint::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Network");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,321 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_TagQuery.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "GameplayTagsManager.h"
+#include "KaosAbilitySystemWorldBinder.h"
+#include "KaosGameplayDebuggerModule.h"
+#include "KaosSlateIMHelpers.h"
+
+FKaosWorldDebugger_TagQuery::~FKaosWorldDebugger_TagQuery()
+{
+	UntrackAll();
+}
+
+void FKaosWorldDebugger_TagQuery::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	if (BoundWorld != World)
+	{
+		UntrackAll();
+		BoundWorld = World;
+		TimeSinceLastScan = TNumericLimits<double>::Max();
+	}
+
+	TimeSinceLastScan += Context.DeltaTime;
+	if (TimeSinceLastScan >= ScanInterval)
+	{
+		ScanWorld(World);
+		TimeSinceLastScan = 0;
+	}
+
+	SlateIM::BeginHorizontalStack();
+	SlateIM::VAlign(VAlign_Center);
+	SlateIM::Text(TEXT("Tags:"));
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::EditableText(QueryText, TEXT("State.Stunned, State.Dead"));
+	SlateIM::MinWidth(120.f);
+	SlateIM::ComboBox(QueryModeNames, QueryModeIndex, bForceModeComboRefresh);
+	bForceModeComboRefresh = false;
+	SlateIM::EndHorizontalStack();
+
+	if (QueryText != AppliedQueryText || QueryModeIndex != AppliedQueryModeIndex)
+	{
+		RebuildQuery();
+	}
+
+	if (UnknownTags.Num() > 0)
+	{
+		KaosSlateIM::WarningText(FString::Printf(TEXT("Unknown tags: %s"), *FString::Join(UnknownTags, TEXT(", "))));
+	}
+
+	KaosSlateIM::DrawLabledText(TEXT("Ability System Components"), FString::FromInt(TrackedComponents.Num()));
+	KaosSlateIM::DrawLabledText(TEXT("Indexed Tags"), FString::FromInt(TagIndex.Num()));
+
+	if (Query.IsEmpty())
+	{
+		KaosSlateIM::WarningText(TEXT("Enter one or more Gameplay Tags to query."));
+		return;
+	}
+
+	if (bResultsDirty)
+	{
+		SortedResults = Results.Array();
+		SortedResults.RemoveAll([](const FEntryKey& Key) { return !Key.IsValid(); });
+		SortedResults.Sort([this](const FEntryKey& A, const FEntryKey& B)
+		{
+			return TrackedComponents.FindChecked(A).OwnerName < TrackedComponents.FindChecked(B).OwnerName;
+		});
+		bResultsDirty = false;
+	}
+
+	KaosSlateIM::SubHeaderText(FString::Printf(TEXT("%d Matching"), SortedResults.Num()));
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(240.f); SlateIM::AddTableColumn(TEXT("Owner"));
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Component"));
+	SlateIM::InitialTableColumnWidth(400.f); SlateIM::AddTableColumn(TEXT("Owned Tags"));
+
+	for (const FEntryKey& Key : SortedResults)
+	{
+		UAbilitySystemComponent* AbilityComp = Key.Get();
+		if (!AbilityComp)
+		{
+			continue;
+		}
+
+		const FKaosTrackedComponent& Tracked = TrackedComponents.FindChecked(Key);
+		if (SlateIM::NextTableCell())
+		{
+			if (SlateIM::Button(Tracked.OwnerName, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+			{
+				FKaosGameplayDebuggerModule::Get().SelectActor(Tracked.Owner.Get());
+			}
+		}
+		if (SlateIM::NextTableCell()) SlateIM::Text(AbilityComp->GetName());
+		if (SlateIM::NextTableCell()) SlateIM::Text(AbilityComp->GetOwnedGameplayTags().ToStringSimple());
+	}
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_TagQuery::ScanWorld(UWorld* World)
+{
+	TArray<UAbilitySystemComponent*> Components;
+	KaosAbilitySystem::GetComponentsInWorld(World, Components);
+	for (UAbilitySystemComponent* AbilityComp : Components)
+	{
+		if (!TrackedComponents.Contains(AbilityComp))
+		{
+			TrackComponent(AbilityComp);
+		}
+	}
+
+	for (auto It = TrackedComponents.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			RemoveFromIndex(It.Key());
+			Results.Remove(It.Key());
+			It.RemoveCurrent();
+			bResultsDirty = true;
+		}
+	}
+}
+
+void FKaosWorldDebugger_TagQuery::TrackComponent(UAbilitySystemComponent* AbilityComp)
+{
+	const FEntryKey Key(AbilityComp);
+	FKaosTrackedComponent& Tracked = TrackedComponents.Add(Key);
+	Tracked.Owner = AbilityComp->GetOwnerActor();
+	Tracked.OwnerName = GetNameSafe(AbilityComp->GetOwnerActor());
+	Tracked.TagEventHandle = AbilityComp->RegisterGenericGameplayTagEvent().AddRaw(this, &FKaosWorldDebugger_TagQuery::OnTagCountChanged, Key);
+
+	// The generic event fires for parent tags as well, so seed the index the same way
+	const FGameplayTagContainer OwnedTags = AbilityComp->GetOwnedGameplayTags().GetGameplayTagParents();
+	for (const FGameplayTag& Tag : OwnedTags)
+	{
+		TagIndex.FindOrAdd(Tag).Add(Key);
+	}
+
+	EvaluateComponent(Key);
+}
+
+void FKaosWorldDebugger_TagQuery::UntrackAll()
+{
+	for (const auto& Pair : TrackedComponents)
+	{
+		if (UAbilitySystemComponent* AbilityComp = Pair.Key.Get())
+		{
+			AbilityComp->RegisterGenericGameplayTagEvent().Remove(Pair.Value.TagEventHandle);
+		}
+	}
+
+	TrackedComponents.Reset();
+	TagIndex.Reset();
+	Results.Reset();
+	SortedResults.Reset();
+	bResultsDirty = false;
+}
+
+void FKaosWorldDebugger_TagQuery::RemoveFromIndex(const FEntryKey& AbilityComp)
+{
+	for (auto It = TagIndex.CreateIterator(); It; ++It)
+	{
+		It.Value().Remove(AbilityComp);
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FKaosWorldDebugger_TagQuery::OnTagCountChanged(const FGameplayTag Tag, int32 NewCount, FEntryKey AbilityComp)
+{
+	if (NewCount > 0)
+	{
+		TagIndex.FindOrAdd(Tag).Add(AbilityComp);
+	}
+	else if (TSet<FEntryKey>* Owners = TagIndex.Find(Tag))
+	{
+		Owners->Remove(AbilityComp);
+		if (Owners->IsEmpty())
+		{
+			TagIndex.Remove(Tag);
+		}
+	}
+
+	if (QueryTags.Contains(Tag))
+	{
+		EvaluateComponent(AbilityComp);
+	}
+}
+
+void FKaosWorldDebugger_TagQuery::RebuildQuery()
+{
+	AppliedQueryText = QueryText;
+	AppliedQueryModeIndex = QueryModeIndex;
+	UnknownTags.Reset();
+
+	TArray<FString> TagNames;
+	QueryText.Replace(TEXT(","), TEXT(" ")).ParseIntoArrayWS(TagNames);
+
+	FGameplayTagContainer Tags;
+	for (const FString& TagName : TagNames)
+	{
+		const FGameplayTag Tag = UGameplayTagsManager::Get().RequestGameplayTag(FName(*TagName), false);
+		if (Tag.IsValid())
+		{
+			Tags.AddTag(Tag);
+		}
+		else
+		{
+			UnknownTags.Add(TagName);
+		}
+	}
+
+	switch (static_cast<EKaosTagQueryMode>(QueryModeIndex))
+	{
+	case EKaosTagQueryMode::Any: Query = Tags.IsEmpty() ? FGameplayTagQuery() : FGameplayTagQuery::MakeQuery_MatchAnyTags(Tags); break;
+	case EKaosTagQueryMode::All: Query = Tags.IsEmpty() ? FGameplayTagQuery() : FGameplayTagQuery::MakeQuery_MatchAllTags(Tags); break;
+	case EKaosTagQueryMode::None: Query = Tags.IsEmpty() ? FGameplayTagQuery() : FGameplayTagQuery::MakeQuery_MatchNoTags(Tags); break;
+	}
+
+	QueryTags.Reset();
+	QueryTags.Append(Tags.GetGameplayTagArray());
+
+	RunQuery();
+}
+
+void FKaosWorldDebugger_TagQuery::RunQuery()
+{
+	Results.Reset();
+	bResultsDirty = true;
+	if (Query.IsEmpty())
+	{
+		return;
+	}
+
+	// A query that an empty container satisfies (Match None) can hit ASCs the index knows nothing about
+	if (Query.Matches(FGameplayTagContainer::EmptyContainer))
+	{
+		for (const auto& Pair : TrackedComponents)
+		{
+			EvaluateComponent(Pair.Key);
+		}
+		return;
+	}
+
+	// Otherwise only ASCs owning at least one of the queried tags can match
+	TSet<FEntryKey> Candidates;
+	for (const FGameplayTag& Tag : QueryTags)
+	{
+		if (const TSet<FEntryKey>* Owners = TagIndex.Find(Tag))
+		{
+			Candidates.Append(*Owners);
+		}
+	}
+
+	for (const FEntryKey& Candidate : Candidates)
+	{
+		EvaluateComponent(Candidate);
+	}
+}
+
+void FKaosWorldDebugger_TagQuery::EvaluateComponent(const FEntryKey& AbilityComp)
+{
+	const UAbilitySystemComponent* Comp = AbilityComp.Get();
+	const bool bMatches = Comp && !Query.IsEmpty() && Query.Matches(Comp->GetOwnedGameplayTags());
+	const bool bWasMatching = Results.Contains(AbilityComp);
+	if (bMatches != bWasMatching)
+	{
+		if (bMatches)
+		{
+			Results.Add(AbilityComp);
+		}
+		else
+		{
+			Results.Remove(AbilityComp);
+		}
+		bResultsDirty = true;
+	}
+}
+
+FSlateIcon FKaosWorldDebugger_TagQuery::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Search");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,106 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AttributeSet.h"
+#include "GameplayEffect.h"
+#include "UObject/UObjectGlobals.h"
+
+/**
+ * Reflection derived data the debugger tabs need, which never changes for a given class.
+ * Built on first use and dropped on hot reload / blueprint compile.
+ */
+class KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API FKaosAbilitySystemDebugCache
+{
+public:
+	struct FKaosAttributeMetadata
+	{
+		FGameplayAttribute Attribute;
+		FString DisplayName;
+		bool bReplicated = false;
+		FString ReplicationCondition;
+		bool bRepNotify = false;
+	};
+
+	struct FKaosAttributeSetMetadata
+	{
+		FString ClassName;
+		TArray<FKaosAttributeMetadata> Attributes;
+		/** Instance size including everything inherited from UAttributeSet and UObject */
+		int32 PropertiesSize = 0;
+		int32 AttributeDataCount = 0;
+		int32 AttributeDataBytes = 0;
+	};
+
+	struct FKaosEffectModifierSummary
+	{
+		FString Attribute;
+		FString CalcType;
+		FString CustomClass;
+		/** Kept so the static magnitude can be evaluated at the level of the active spec */
+		FGameplayEffectModifierMagnitude Magnitude;
+	};
+
+	struct FKaosEffectExecutionSummary
+	{
+		FString CalculationClass;
+		FString PassedInTags;
+		TArray<FString> ConditionalEffects;
+		TArray<FString> CalculationModifiers;
+	};
+
+	struct FKaosEffectDefinitionSummary
+	{
+		FString ClassName;
+		TArray<FKaosEffectModifierSummary> Modifiers;
+		TArray<FKaosEffectExecutionSummary> Executions;
+		FString StackingType;
+		bool bStacks = false;
+		int32 StackLimitCount = 0;
+		FString StackDurationRefreshPolicy;
+		FString StackExpirationPolicy;
+		FString StackPeriodResetPolicy;
+		FString GrantedTags;
+		FString AssetTags;
+	};
+
+	FKaosAbilitySystemDebugCache();
+	~FKaosAbilitySystemDebugCache();
+
+	const FKaosAttributeSetMetadata& GetAttributeSetMetadata(TSubclassOf<UAttributeSet> AttributeSetClass);
+	const FKaosEffectDefinitionSummary& GetEffectDefinitionSummary(const UGameplayEffect* Definition);
+
+	void Invalidate();
+
+private:
+	TMap<TWeakObjectPtr<UClass>, FKaosAttributeSetMetadata> AttributeSetMetadata;
+	TMap<TWeakObjectPtr<const UGameplayEffect>, FKaosEffectDefinitionSummary> EffectDefinitionSummaries;
+
+	FDelegateHandle ReloadCompleteHandle;
+#if WITH_EDITOR
+	FDelegateHandle BlueprintCompiledHandle;
+#endif
+
+	void BindEditorInvalidation();
+	void OnReloadComplete(EReloadCompleteReason Reason);
+};
+#endif
@@ -0,0 +1,66 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+
+class UAbilitySystemComponent;
+
+/**
+ * ASCs can live on actors or on player states, so finding them goes through the object hash rather than the actor list.
+ * Every one shot world scan in this module goes through here, the time sliced ones use TKaosWorldRollup.
+ */
+namespace KaosAbilitySystem
+{
+	KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API void ForEachComponent(TFunctionRef<void(UAbilitySystemComponent* AbilityComp)> Callback);
+	KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API void GetComponentsInWorld(const UWorld* World, TArray<UAbilitySystemComponent*>& OutComponents);
+}
+
+/**
+ * Keeps a set of delegates bound on every Ability System Component in one world.
+ * There is no global spawn event for ASCs, so new ones are picked up by a cheap periodic rescan.
+ */
+class KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API FKaosAbilitySystemWorldBinder
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnAbilitySystem, UAbilitySystemComponent*);
+
+	/** Called once per ASC when it is first seen */
+	FOnAbilitySystem OnBind;
+	/** Called for every still valid ASC when the binder is reset or moves to another world */
+	FOnAbilitySystem OnUnbind;
+
+	float ScanInterval = 1.f;
+
+	~FKaosAbilitySystemWorldBinder();
+
+	void Tick(UWorld* World, float DeltaTime);
+	void UnbindAll();
+
+	int32 Num() const { return BoundComponents.Num(); }
+	UWorld* GetWorld() const { return BoundWorld.Get(); }
+
+private:
+	TWeakObjectPtr<UWorld> BoundWorld;
+	TSet<TWeakObjectPtr<UAbilitySystemComponent>> BoundComponents;
+	double TimeSinceLastScan = TNumericLimits<double>::Max();
+};
+#endif
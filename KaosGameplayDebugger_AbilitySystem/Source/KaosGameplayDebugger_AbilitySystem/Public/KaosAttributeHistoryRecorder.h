@@ -0,0 +1,93 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AttributeSet.h"
+#include "Containers/Ticker.h"
+#include "KaosDebuggerRingBuffer.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * Samples pinned attributes at a fixed rate into ring buffers, independent of which tab is open.
+ * Every buffer holds SampleRate * HistorySeconds samples, clamped so a single pin never grows past a known size.
+ */
+class KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API FKaosAttributeHistoryRecorder
+{
+public:
+	struct FKaosAttributeSample
+	{
+		double Time = 0.0;
+		float Value = 0.f;
+	};
+
+	struct FKaosPinnedAttribute
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystem;
+		FGameplayAttribute Attribute;
+		FString OwnerName;
+		FString AttributeName;
+		TKaosRingBuffer<FKaosAttributeSample> Samples;
+
+		/** Decimated plot, only rebuilt when new samples arrive or the window changes */
+		TArray<FVector2D> PlotPoints;
+		uint64 PlotSampleStamp = MAX_uint64;
+		double PlotWindowSeconds = 0.0;
+	};
+
+	static constexpr int32 MaxSamplesPerAttribute = 36000;
+
+	~FKaosAttributeHistoryRecorder();
+
+	void Pin(UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute);
+	void Unpin(const UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute);
+	/** Removes by position, the only way to drop a pin whose ability system is already gone */
+	void UnpinAt(int32 Index);
+	void UnpinAll();
+	bool IsPinned(const UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute) const;
+
+	void SetSampleRate(float InSampleRate);
+	float GetSampleRate() const { return SampleRate; }
+	void SetHistorySeconds(float InHistorySeconds);
+	float GetHistorySeconds() const { return HistorySeconds; }
+	int32 GetSamplesPerAttribute() const;
+
+	TArray<FKaosPinnedAttribute>& GetPinnedAttributes() { return PinnedAttributes; }
+	SIZE_T GetAllocatedSize(const FKaosPinnedAttribute& Pinned) const;
+	SIZE_T GetAllocatedSize() const;
+
+	/** Plot of the last WindowSeconds of samples, at most two points (min and max) per bucket */
+	const TArray<FVector2D>& GetPlotPoints(FKaosPinnedAttribute& Pinned, double WindowSeconds, int32 NumBuckets) const;
+
+	static void Decimate(const TKaosRingBuffer<FKaosAttributeSample>& Samples, double StartTime, double EndTime, int32 NumBuckets, TArray<FVector2D>& OutPoints);
+
+private:
+	TArray<FKaosPinnedAttribute> PinnedAttributes;
+	float SampleRate = 10.f;
+	float HistorySeconds = 600.f;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	bool Tick(float DeltaTime);
+	void UpdateTicker();
+	void ResizeBuffers();
+};
+#endif
@@ -19,6 +19,8 @@
 // DEALINGS IN THE SOFTWARE.
 #pragma once
 
+#include "KaosAbilitySystemDebugCache.h"
+#include "KaosAttributeHistoryRecorder.h"
 #include "KaosDebuggerBaseItem.h"
 #include "KaosGameplayDebuggerModule.h"
 #include "Modules/ModuleManager.h"
@@ -27,12 +29,37 @@ class FKaosGameplayDebugger_AbilitySystemModule : public IModuleInterface
 {
 public:
 
+	static FKaosGameplayDebugger_AbilitySystemModule& Get()
+	{
+		static FKaosGameplayDebugger_AbilitySystemModule& Singleton = FModuleManager::LoadModuleChecked<FKaosGameplayDebugger_AbilitySystemModule>("KaosGameplayDebugger_AbilitySystem");
+		return Singleton;
+	}
+
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+	FKaosAbilitySystemDebugCache& GetDebugCache() { return DebugCache; }
+	FKaosAttributeHistoryRecorder& GetAttributeHistory() { return AttributeHistory; }
+#endif
+
 private:
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 	TArray<FKaosDebuggerSubCategoryHandle> RegisteredSubCategories;
+	FDelegateHandle CollectWorldStatsHandle;
+	FKaosAbilitySystemDebugCache DebugCache;
+	FKaosAttributeHistoryRecorder AttributeHistory;
+
+	struct FKaosWorldAbilityStats
+	{
+		int32 NumComponents = 0;
+		int32 NumActiveEffects = 0;
+	};
+
+	TMap<TWeakObjectPtr<UWorld>, FKaosWorldAbilityStats> WorldStats;
+	uint64 WorldStatsFrame = MAX_uint64;
+
+	void CollectWorldStats(UWorld* World, TArray<FKaosDebugLine>& OutLines);
 #endif
 };
@@ -0,0 +1,103 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "ActiveGameplayEffectHandle.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+class UWorld;
+
+/**
+ * Applies a Gameplay Effect in bulk, N times per target per frame for M frames, from a core ticker so it keeps
+ * running whichever tab is open. Frame time is sampled for a short baseline before the run to report the delta.
+ * Every effect a run leaves active is remembered so it can be taken off again afterwards.
+ */
+class FKaosGameplayEffectStressTest
+{
+public:
+	~FKaosGameplayEffectStressTest();
+
+	/** SelectedASC may be null, matching owners are still found through World */
+	void Draw(UWorld* World, UAbilitySystemComponent* SelectedASC);
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		Baseline,
+		Applying
+	};
+
+	static constexpr int32 BaselineFrames = 30;
+
+	TArray<TWeakObjectPtr<UClass>> EffectClasses;
+	TArray<FString> EffectClassNames;
+	int32 SelectedEffectIndex = 0;
+	bool bForceEffectComboRefresh = true;
+
+	float Level = 1.f;
+	FString SetByCallerText;
+	bool bAllMatchingOwners = false;
+	FString OwnerClassFilter;
+	int32 ApplicationsPerFrame = 1;
+	int32 NumFrames = 1;
+
+	EPhase Phase = EPhase::Idle;
+	FTSTicker::FDelegateHandle TickerHandle;
+	TWeakObjectPtr<UClass> RunEffectClass;
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> RunTargets;
+	TMap<FGameplayTag, float> RunSetByCallers;
+	float RunLevel = 1.f;
+	int32 FramesRemaining = 0;
+
+	// Results of the last run, all times in seconds
+	int32 SkippedTargets = 0;
+	int32 Applications = 0;
+	double BaselineFrameTime = 0.0;
+	double RunFrameTime = 0.0;
+	double MaxRunFrameTime = 0.0;
+	double ApplyTime = 0.0;
+	int32 SampledBaselineFrames = 0;
+	int32 SampledRunFrames = 0;
+	/** Stop was pressed while applying, the averages only cover the frames that ran */
+	bool bStoppedEarly = false;
+	TArray<FString> SetByCallerErrors;
+
+	/** Handles already active on the targets when a run started, stacking onto them must not mark them as ours */
+	TSet<FActiveGameplayEffectHandle> PreexistingHandles;
+	/** Effects still active that runs applied, kept across runs until they are removed */
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, TSet<FActiveGameplayEffectHandle>> AppliedHandles;
+	int32 NumAppliedHandles = 0;
+
+	void RefreshEffectClasses();
+	void Start(UWorld* World, UAbilitySystemComponent* SelectedASC);
+	void Stop();
+	bool Tick(float DeltaTime);
+	void ApplyFrame();
+	void RemoveAppliedEffects();
+	void DrawResults() const;
+};
+#endif
@@ -0,0 +1,49 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayPrediction.h"
+
+/**
+ * Forwards the caught up / rejected callbacks of prediction keys to its owner.
+ * Those delegates cannot be unbound once set, so they only hold a weak reference and go quiet after Reset or destruction.
+ */
+class KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API FKaosPredictionKeyListener
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnPredictionKey, FPredictionKey::KeyType);
+
+	FOnPredictionKey OnCaughtUp;
+	FOnPredictionKey OnRejected;
+
+	FKaosPredictionKeyListener();
+	FKaosPredictionKeyListener(const FKaosPredictionKeyListener&) = delete;
+	FKaosPredictionKeyListener& operator=(const FKaosPredictionKeyListener&) = delete;
+
+	void Listen(FPredictionKey PredictionKey);
+	/** Keys listened to before this never call back */
+	void Reset();
+
+private:
+	TSharedRef<FKaosPredictionKeyListener*> Self;
+};
+#endif
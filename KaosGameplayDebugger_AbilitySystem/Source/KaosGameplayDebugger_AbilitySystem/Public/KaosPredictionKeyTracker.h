@@ -0,0 +1,77 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayPrediction.h"
+#include "KaosDebuggerRingBuffer.h"
+#include "KaosPredictionKeyListener.h"
+
+class UGameplayAbility;
+
+/** A locally predicted key the server has not caught up with yet */
+struct FKaosInFlightPredictionKey
+{
+	/** Null for keys predicted outside of an ability */
+	TWeakObjectPtr<UClass> AbilityClass;
+	double IssuedTime = 0.0;
+	int32 PredictedEffects = 0;
+};
+
+/**
+ * Bounded set of the prediction keys the local client issued and is still waiting on.
+ * A resolved key is remembered for a while, so the server's copy of a predicted effect arriving with the same key
+ * doesn't count as a newly issued one.
+ */
+class KAOSGAMEPLAYDEBUGGER_ABILITYSYSTEM_API FKaosPredictionKeyTracker
+{
+public:
+	DECLARE_DELEGATE_TwoParams(FOnKeyResolved, FPredictionKey::KeyType, const FKaosInFlightPredictionKey&);
+
+	FOnKeyResolved OnCaughtUp;
+	FOnKeyResolved OnRejected;
+
+	FKaosPredictionKeyTracker();
+
+	/** Returns the entry for a key that is still in flight, adding it if this is the first time it is seen. */
+	FKaosInFlightPredictionKey* Track(FPredictionKey PredictionKey, const UGameplayAbility* Ability, bool& bOutAdded);
+	/** Forgets every key, keys tracked before this never resolve */
+	void Reset();
+
+	int32 Num() const { return InFlightKeys.Num(); }
+	int32 GetDroppedKeys() const { return DroppedKeys; }
+	/** Seconds since the oldest key still in flight was issued */
+	double GetOldestAge() const;
+
+private:
+	/** Keys past this are counted as dropped instead of tracked, a server that never answers cannot grow the map */
+	static constexpr int32 MaxInFlightKeys = 1024;
+	static constexpr int32 MaxResolvedKeys = 256;
+
+	TMap<FPredictionKey::KeyType, FKaosInFlightPredictionKey> InFlightKeys;
+	TSet<FPredictionKey::KeyType> ResolvedKeys;
+	TKaosRingBuffer<FPredictionKey::KeyType> ResolvedOrder { MaxResolvedKeys };
+	FKaosPredictionKeyListener Listener;
+	int32 DroppedKeys = 0;
+
+	void ResolveKey(FPredictionKey::KeyType Key, const FOnKeyResolved& Callback);
+};
+#endif
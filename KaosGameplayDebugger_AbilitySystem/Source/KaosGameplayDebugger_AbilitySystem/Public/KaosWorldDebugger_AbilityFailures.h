@@ -0,0 +1,77 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayTagContainer.h"
+#include "KaosAbilitySystemWorldBinder.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerRateCounters.h"
+#include "UObject/ObjectKey.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+struct FKaosWorldDebugger_AbilityFailures : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_AbilityFailures();
+	virtual ~FKaosWorldDebugger_AbilityFailures();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
+
+private:
+	static constexpr int32 MaxFailureRows = 256;
+
+	using FFailureKey = TPair<TObjectKey<UClass>, FGameplayTag>;
+
+	/** One ability class and failure tag pair, a failure with several tags counts once per tag */
+	struct FKaosFailureRow
+	{
+		FString AbilityName;
+		FString Reason;
+		double LastFailureTime = 0.0;
+		TWeakObjectPtr<UAbilitySystemComponent> LastComponent;
+	};
+
+	using FFailureCounters = TKaosRateCounters<FFailureKey, FKaosFailureRow>;
+	FFailureCounters Counters { MaxFailureRows, { TEXT("(Other)"), TEXT("(Other)") } };
+
+	FKaosAbilitySystemWorldBinder Binder;
+	bool bRecording = true;
+	float RateWindow = 1.f;
+	uint64 LastTickFrame = MAX_uint64;
+
+	void BindAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	int32 FindCounterIndex(const UGameplayAbility* Ability, const FGameplayTag& Reason);
+
+	void OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureTags, TWeakObjectPtr<UAbilitySystemComponent> AbilityComp);
+	void RecordFailure(int32 Index, const TWeakObjectPtr<UAbilitySystemComponent>& AbilityComp);
+
+	/** Binder and rate window upkeep, shared by drawing and streaming and run at most once per frame */
+	void TickRecording(UWorld* World, float DeltaTime);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Ability Failures")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
@@ -0,0 +1,102 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayAbilitySpec.h"
+#include "GameplayPrediction.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerHistogram.h"
+#include "KaosPredictionKeyTracker.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+#include "UObject/ObjectKey.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+struct FAbilityEndedData;
+
+struct FKaosWorldDebugger_AbilityLatency : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_AbilityLatency();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	/** Everything recorded for one ability class on the bound ASC, all times are in seconds */
+	struct FKaosAbilityLatencyStats
+	{
+		FString AbilityName;
+		int32 Activations = 0;
+		int32 Commits = 0;
+		int32 Ends = 0;
+		int32 Cancels = 0;
+		int32 Failures = 0;
+		int32 Predicted = 0;
+		int32 Confirmed = 0;
+		int32 Rejected = 0;
+		FKaosLogHistogram ActivateToCommit;
+		FKaosLogHistogram ActivateToEnd;
+		/** Client only, from the predicted activation until the server caught up with its prediction key */
+		FKaosLogHistogram PredictedToConfirmed;
+		TMap<FString, int32> FailureReasons;
+	};
+
+	/** Activation that has not ended yet */
+	struct FKaosInFlightActivation
+	{
+		TWeakObjectPtr<UClass> AbilityClass;
+		double ActivatedTime = 0.0;
+		bool bCommitted = false;
+	};
+
+	/** Instanced per execution abilities run concurrently under one spec, so the instance is part of the key */
+	using FKaosActivationKey = TPair<FGameplayAbilitySpecHandle, TObjectKey<UGameplayAbility>>;
+
+	TMap<TWeakObjectPtr<UClass>, FKaosAbilityLatencyStats> LatencyStats;
+	TMap<FKaosActivationKey, FKaosInFlightActivation> InFlightActivations;
+	FKaosPredictionKeyTracker PredictionTracker;
+	TOptional<TWeakObjectPtr<UClass>> SelectedAbilityClass;
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	FDelegateHandle ActivatedHandle;
+	FDelegateHandle CommittedHandle;
+	FDelegateHandle EndedHandle;
+	FDelegateHandle FailedHandle;
+
+	void BindToAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindFromAbilitySystem();
+	FKaosAbilityLatencyStats& FindOrAddStats(const UGameplayAbility* Ability);
+
+	void OnAbilityActivated(UGameplayAbility* Ability);
+	void OnAbilityCommitted(UGameplayAbility* Ability);
+	void OnAbilityEnded(const FAbilityEndedData& EndedData);
+	void OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureTags);
+	void OnPredictionCaughtUp(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight);
+	void OnPredictionRejected(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight);
+
+	void DrawLatencyTable();
+	void DrawLatencyDetails();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Ability Latency")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
@@ -0,0 +1,59 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerRingBuffer.h"
+#include "KaosDebuggerStats.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+struct FKaosWorldDebugger_AbilitySystemStats : public IKaosDebuggerBaseItem
+{
+public:
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	static constexpr int32 MaxHistoryFrames = 600;
+
+	/** Latest value of one stat plus a per frame history for the rolling average */
+	struct FKaosStatHistory
+	{
+		FKaosStatValue Latest;
+		TKaosRingBuffer<double> History { MaxHistoryFrames };
+		uint64 LastSampledFrame = MAX_uint64;
+	};
+
+	TMap<FName, FKaosStatHistory> StatHistories;
+	TArray<FName> StatOrder;
+	TArray<FKaosStatValue> GatheredStats;
+	TOptional<FName> SelectedStat;
+	int32 RollingFrames = 120;
+
+	void SampleStats();
+	void DrawStatTable();
+	void DrawSelectedStat();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Stats")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
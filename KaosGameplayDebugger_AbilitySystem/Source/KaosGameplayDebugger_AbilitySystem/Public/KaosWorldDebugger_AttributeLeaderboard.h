@@ -0,0 +1,81 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "AttributeSet.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class UAbilitySystemComponent;
+struct FOnAttributeChangeData;
+
+struct FKaosWorldDebugger_AttributeLeaderboard : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_AttributeLeaderboard();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	/** One per ASC that has the selected attribute, the value is pushed in by its change delegate */
+	struct FKaosLeaderboardEntry
+	{
+		TWeakObjectPtr<AActor> Owner;
+		FString OwnerName;
+		float Value = 0.f;
+		FDelegateHandle ValueChangeHandle;
+	};
+
+	using FEntryKey = TWeakObjectPtr<UAbilitySystemComponent>;
+
+	TArray<FGameplayAttribute> AvailableAttributes;
+	TArray<FString> AttributeNames;
+	TSet<TWeakObjectPtr<UClass>> KnownAttributeSetClasses;
+	int32 SelectedAttributeIndex = 0;
+	bool bForceAttributeComboRefresh = true;
+
+	TWeakObjectPtr<UWorld> BoundWorld;
+	FGameplayAttribute BoundAttribute;
+	TMap<FEntryKey, FKaosLeaderboardEntry> Entries;
+	double ValueSum = 0.0;
+
+	TArray<FEntryKey> TopEntries;
+	TArray<FEntryKey> BottomEntries;
+	bool bRankingDirty = false;
+
+	int32 NumShown = 10;
+	float ScanInterval = 1.f;
+	double TimeSinceLastScan = TNumericLimits<double>::Max();
+
+	void ScanWorld(UWorld* World);
+	void BindAttribute(const FGameplayAttribute& Attribute);
+	void AddEntry(UAbilitySystemComponent* AbilityComp);
+	void UnbindAll();
+	void OnAttributeValueChanged(const FOnAttributeChangeData& ChangeData, FEntryKey AbilityComp);
+	void UpdateRanking();
+
+	void DrawRankingTable(const TCHAR* Title, const TArray<FEntryKey>& Ranking);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Attribute Leaderboard")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
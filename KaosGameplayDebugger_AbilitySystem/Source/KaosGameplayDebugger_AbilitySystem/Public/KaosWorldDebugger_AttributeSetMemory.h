@@ -0,0 +1,82 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerWorldRollup.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class UAbilitySystemComponent;
+
+struct FKaosWorldDebugger_AttributeSetMemory : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_AttributeSetMemory();
+
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	struct FKaosOwnerClassMemory
+	{
+		FString OwnerClassName;
+		int32 Components = 0;
+		int32 AttributeSets = 0;
+		int32 AttributeData = 0;
+		int32 Aggregators = 0;
+		int64 SetBytes = 0;
+		int64 AttributeDataBytes = 0;
+		int64 AggregatorBytes = 0;
+	};
+
+	struct FKaosAttributeSetClassMemory
+	{
+		FString SetClassName;
+		int32 Instances = 0;
+		int32 PropertiesSize = 0;
+		int32 AttributeDataCount = 0;
+	};
+
+	struct FKaosMemoryRollup
+	{
+		TArray<FKaosOwnerClassMemory> OwnerClasses;
+		TArray<FKaosAttributeSetClassMemory> SetClasses;
+		TMap<TWeakObjectPtr<UClass>, int32> OwnerClassIndices;
+		TMap<TWeakObjectPtr<UClass>, int32> SetClassIndices;
+		int32 TotalComponents = 0;
+		int32 TotalAttributeSets = 0;
+		int64 TotalBytes = 0;
+	};
+
+	TKaosWorldRollup<UAbilitySystemComponent, FKaosMemoryRollup> Rollup;
+
+	/** Attributes with an aggregator, which only exist once a duration or infinite effect has modified them */
+	static int32 CountAggregators(const UAbilitySystemComponent* AbilityComp);
+	static void ProcessAbilitySystem(const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC, FKaosMemoryRollup& Result);
+
+	void DrawSelectedMemory(const UAbilitySystemComponent* AbilityComp);
+	void DrawRollup();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Attribute Set Memory")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
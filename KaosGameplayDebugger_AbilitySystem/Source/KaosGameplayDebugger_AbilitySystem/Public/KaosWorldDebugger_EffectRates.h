@@ -0,0 +1,74 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "ActiveGameplayEffectHandle.h"
+#include "KaosAbilitySystemWorldBinder.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerRateCounters.h"
+#include "UObject/ObjectKey.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+struct FGameplayEffectSpec;
+
+struct FKaosWorldDebugger_EffectRates : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_EffectRates();
+	virtual ~FKaosWorldDebugger_EffectRates();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	static constexpr int32 MaxEffectClasses = 256;
+
+	enum EKaosEffectRateChannel : int32
+	{
+		Applied,
+		Periodic,
+		NumChannels
+	};
+
+	using FEffectCounters = TKaosRateCounters<TObjectKey<UClass>, FString, NumChannels>;
+	/** Row data is the effect class name */
+	FEffectCounters Counters { MaxEffectClasses, TEXT("(Other)") };
+
+	FKaosAbilitySystemWorldBinder Binder;
+	bool bRecording = true;
+	float RateWindow = 1.f;
+	uint64 LastTickFrame = MAX_uint64;
+
+	void BindAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	int32 FindCounterIndex(const UGameplayEffect* Definition);
+
+	void OnEffectApplied(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnPeriodicExecuted(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+
+	/** Binder and rate window upkeep, run at most once per frame */
+	void TickRecording(UWorld* World, float DeltaTime);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Effect Rates")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
@@ -21,6 +21,7 @@
 
 #include "CoreMinimal.h"
 #if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayAbilitySpec.h"
 #include "GameplayEffect.h"
 #include "KaosDebuggerBaseItem.h"
 #include "KaosDebuggerContext.h"
@@ -33,31 +34,59 @@ class UAbilitySystemComponent;
 
 struct FKaosWorldDebugger_GameplayAbilities : public IKaosDebuggerBaseItem
 {
+	/** Times the row collection and table text paths directly, see KaosGameplayDebugger.AbilitySystem.Benchmark */
+	friend class FKaosAbilitySystemBenchmark;
+
 public:
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
 	
 private:
-	TOptional<FString> SelectedAbilityName;
+	TOptional<FGameplayAbilitySpecHandle> SelectedAbilityHandle;
 	TWeakObjectPtr<class AActor> LastSelectedActor;
 
 	struct FKaosGameplayAbilityDebug
 	{
+		FGameplayAbilitySpecHandle Handle;
+		/** Hash of the spec fields the row was built from, the row is only rebuilt when it changes */
+		uint32 SpecSignature = 0;
 		FString Ability;
 		FString Source;
 		int32 Level = 0;
-		bool bIsActive = false;
 		FGameplayTagContainer AbilityTags;
 		int32 InputID;
-		uint8 InputPressed;
-		uint8 ActiveCount;
 		TMap<FGameplayTag, float> SetByCallerTagMagnitudes;
 		FGameplayTagContainer CooldownTags;
+
+		// Refreshed every frame, these change locally without dirtying the spec
+		bool bIsActive = false;
+		uint8 InputPressed;
+		uint8 ActiveCount;
 	};
-	TArray<FKaosGameplayAbilityDebug> CollectAbilityData(const UAbilitySystemComponent* AbilityComp) const;
 
+	TMap<FGameplayAbilitySpecHandle, FKaosGameplayAbilityDebug> AbilityRows;
+	TArray<FGameplayAbilitySpecHandle> SortedHandles;
+	TWeakObjectPtr<const UAbilitySystemComponent> CachedASC;
+	/** INDEX_NONE until the first build, or always when the container can't be reached */
+	int32 CachedArrayReplicationKey = INDEX_NONE;
+	int32 CachedAbilityCount = INDEX_NONE;
+
+	void UpdateAbilityRows(const UAbilitySystemComponent* AbilityComp);
+	void RefreshVolatileFields(const UAbilitySystemComponent* AbilityComp);
+	static uint32 GetSpecSignature(const FGameplayAbilitySpec& AbilitySpec);
+	static const FGameplayAbilitySpecContainer* GetAbilityContainer(const UAbilitySystemComponent* AbilityComp);
+	static void BuildAbilityRow(const FGameplayAbilitySpec& AbilitySpec, FKaosGameplayAbilityDebug& ItemData);
+
+
+	/** Table text for the level and state columns, built apart from SlateIM so it can be timed headless */
+	struct FKaosGameplayAbilityRowText
+	{
+		FString Level;
+		FString Active;
+	};
 
-	void DrawWorldDebugger_Abilities(const TArray<FKaosGameplayAbilityDebug>& Abilities);
-	void DrawWorldDebugger_AbilityDetails(const TArray<FKaosGameplayAbilityDebug>& Abilities);
+	static FKaosGameplayAbilityRowText FormatAbilityRow(const FKaosGameplayAbilityDebug& Row);
+	void DrawWorldDebugger_Abilities();
+	void DrawWorldDebugger_AbilityDetails();
 
 
 public:
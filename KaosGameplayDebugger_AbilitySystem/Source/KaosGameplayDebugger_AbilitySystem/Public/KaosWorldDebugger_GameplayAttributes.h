@@ -31,12 +31,15 @@ class UAbilitySystemComponent;
 
 struct FKaosWorldDebugger_GameplayAttributes : public IKaosDebuggerBaseItem
 {
+	/** Times the row collection and table text paths directly, see KaosGameplayDebugger.AbilitySystem.Benchmark */
+	friend class FKaosAbilitySystemBenchmark;
+
 public:
+	virtual ~FKaosWorldDebugger_GameplayAttributes();
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
 	
 private:
-	TOptional<FString> SelectedAttributeName;
-	TOptional<FString> SelectedAttributeClass;
+	TOptional<FGameplayAttribute> SelectedAttribute;
 	TWeakObjectPtr<class AActor> LastSelectedActor;
 
 
@@ -49,18 +52,41 @@ private:
 		int32 StackCount = 0;
 	};
 	
-	struct FKaosGameplayAttributeDebug
+	/** One row per attribute, values are pushed in by the ASC value change delegate */
+	struct FKaosGameplayAttributeRow
 	{
+		FGameplayAttribute Attribute;
 		FString AttributeName;
 		float BaseValue = 0.0f;
 		float CurrentValue = 0.0f;
 		FString AttributeSetClass;
-		TArray<FKaosGameplayAttributeEffectDebugInfo> ModifyingEffects;
+		FString ReplicationCondition;
+		bool bRepNotify = false;
+		FDelegateHandle ValueChangeHandle;
+	};
+
+	TArray<FKaosGameplayAttributeRow> AttributeRows;
+	TMap<FGameplayAttribute, int32> AttributeRowIndices;
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	int32 BoundAttributeSetCount = 0;
+
+	void BindToAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindFromAbilitySystem();
+	void OnAttributeValueChanged(const FOnAttributeChangeData& ChangeData);
+
+	/** Only ever run for the attribute being inspected */
+	TArray<FKaosGameplayAttributeEffectDebugInfo> CollectModifyingEffects(const UAbilitySystemComponent* AbilityComp, const FGameplayAttribute& Attribute) const;
+
+	/** Table text for the value columns, built apart from SlateIM so it can be timed headless */
+	struct FKaosGameplayAttributeRowText
+	{
+		FString BaseValue;
+		FString CurrentValue;
 	};
-	TArray<FKaosGameplayAttributeDebug>  CollectGameplayAttributes(const UAbilitySystemComponent* AbilityComp);
 
-	void DrawWorldDebugger_Attributes(const TArray<FKaosGameplayAttributeDebug>& Attributes);
-	void DrawWorldDebugger_AttributeDetails(const TArray<FKaosGameplayAttributeDebug>& Attributes);
+	static FKaosGameplayAttributeRowText FormatAttributeRow(const FKaosGameplayAttributeRow& Row);
+	void DrawWorldDebugger_Attributes();
+	void DrawWorldDebugger_AttributeDetails(const UAbilitySystemComponent* AbilityComp);
 
 public:
 	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Gameplay Attributes")); }
@@ -23,6 +23,7 @@
 #if WITH_KAOS_GAMEPLAYDEBUGGER
 #include "GameplayEffect.h"
 #include "KaosDebuggerBaseItem.h"
+#include "KaosGameplayEffectStressTest.h"
 #include "KaosWorldDebugger_AbilitySystemTypes.h"
 
 
@@ -31,36 +32,72 @@ class UAbilitySystemComponent;
 
 struct FKaosWorldDebugger_GameplayEffects : public IKaosDebuggerBaseItem
 {
+	/** Times the row collection and table text paths directly, see KaosGameplayDebugger.AbilitySystem.Benchmark */
+	friend class FKaosAbilitySystemBenchmark;
+
 public:
+	virtual ~FKaosWorldDebugger_GameplayEffects();
 	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
 	
 private:
-	struct FKaosGameplayEffectDebug
+	/** One row per active effect, kept up to date by the ASC delegates rather than rebuilt every frame */
+	struct FKaosGameplayEffectRow
 	{
+		FActiveGameplayEffectHandle Handle;
 		int32 ReplicationID = INDEX_NONE; // unique & shared between server/client (or INDEX_NONE if local)
 		FString Effect;
-		FString Context;
 		float Duration = 0.0f;
 		float Period = 0.0f;
 		int32 Stacks = 0;
 		float Level = 0.0f;
 
+		// Refreshed every frame, nothing broadcasts when these change
+		float TimeRemaining = 0.0f;
 		bool bInhibited = false;
-		TMap<FName, float>			SetByCallerNameMagnitudes;
-		TMap<FGameplayTag, float>	SetByCallerTagMagnitudes;
-		FGameplayTagContainer DynamicAssetTags;
-		FGameplayTagContainer DynamicGrantedTags;
-		TArray<FGameplayEffectModifiedAttribute> ModifiedAttributes;
-		TWeakObjectPtr<const UGameplayEffect> Definition;
+
+		FDelegateHandle StackChangeHandle;
+		FDelegateHandle TimeChangeHandle;
 	};
-	TArray<FKaosGameplayEffectDebug> CollectEffectsData(const UAbilitySystemComponent* AbilityComp) const;
 
-	
-	TOptional<int32> SelectedEffectReplicationID;
+	TMap<FActiveGameplayEffectHandle, FKaosGameplayEffectRow> EffectRows;
+	TArray<FActiveGameplayEffectHandle> SortedHandles;
+	bool bSortDirty = false;
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	FDelegateHandle EffectAddedHandle;
+	FDelegateHandle EffectRemovedHandle;
+
+	void BindToAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindFromAbilitySystem();
+	void AddEffectRow(UAbilitySystemComponent* AbilityComp, const FActiveGameplayEffect& ActiveGE);
+	void RefreshVolatileFields(const UAbilitySystemComponent* AbilityComp);
+	void SortRowsIfNeeded();
+
+	void OnActiveEffectAdded(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnActiveEffectRemoved(const FActiveGameplayEffect& ActiveGE);
+	void OnEffectStackChanged(FActiveGameplayEffectHandle Handle, int32 NewStackCount, int32 PreviousStackCount);
+	void OnEffectTimeChanged(FActiveGameplayEffectHandle Handle, float NewStartTime, float NewDuration);
+
+	TOptional<FActiveGameplayEffectHandle> SelectedEffectHandle;
 	TWeakObjectPtr<class AActor> LastSelectedActor;
 
-	void DrawWorldDebugger_Effects(const TArray<FKaosGameplayEffectDebug>& Effects);
-	void DrawWorldDebugger_EffectDetails(const TArray<FKaosGameplayEffectDebug>& Effects);
+	/** Table text for every column after the name, built apart from SlateIM so it can be timed headless */
+	struct FKaosGameplayEffectRowText
+	{
+		FString Inhibited;
+		FString Duration;
+		FString Remaining;
+		FString Stacks;
+	};
+
+	static FKaosGameplayEffectRowText FormatEffectRow(const FKaosGameplayEffectRow& Row);
+	void DrawWorldDebugger_Effects();
+	void DrawWorldDebugger_EffectDetails(const UAbilitySystemComponent* AbilityComp);
+
+	FKaosGameplayEffectStressTest StressTest;
+	bool bShowStressTest = false;
+
+	void DrawStressTest(UWorld* World, UAbilitySystemComponent* AbilityComp);
 
 public:
 	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Gameplay Effects")); }
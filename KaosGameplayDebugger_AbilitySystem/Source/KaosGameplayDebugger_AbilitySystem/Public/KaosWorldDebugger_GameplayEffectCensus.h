@@ -0,0 +1,80 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerWorldRollup.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class UAbilitySystemComponent;
+
+struct FKaosWorldDebugger_GameplayEffectCensus : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_GameplayEffectCensus();
+
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
+
+private:
+	struct FKaosEffectOwnerCensus
+	{
+		FString OwnerName;
+		int32 Instances = 0;
+		int32 Stacks = 0;
+	};
+
+	struct FKaosEffectClassCensus
+	{
+		FString EffectName;
+		int32 Instances = 0;
+		int32 TotalStacks = 0;
+		int32 Periodic = 0;
+		int32 Infinite = 0;
+		int32 Inhibited = 0;
+		TArray<FKaosEffectOwnerCensus> Owners;
+	};
+
+	struct FKaosEffectCensusResult
+	{
+		TArray<FKaosEffectClassCensus> Classes;
+		TMap<TWeakObjectPtr<UClass>, int32> ClassIndices;
+		int32 TotalComponents = 0;
+		int32 TotalEffects = 0;
+		int32 TotalInfinite = 0;
+	};
+
+	TKaosWorldRollup<UAbilitySystemComponent, FKaosEffectCensusResult> Census;
+	TWeakObjectPtr<UWorld> CensusWorld;
+	TOptional<FString> SelectedEffectName;
+
+	void TickCensus(UWorld* World, float DeltaTime);
+	static void ProcessAbilitySystem(const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC, FKaosEffectCensusResult& Result);
+
+	void DrawClassTable(const FKaosEffectCensusResult& Result);
+	void DrawOwnerTable(const FKaosEffectClassCensus& ClassCensus);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Gameplay Effect Census")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
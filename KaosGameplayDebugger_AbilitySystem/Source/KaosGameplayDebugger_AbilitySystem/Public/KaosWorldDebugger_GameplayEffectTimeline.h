@@ -0,0 +1,123 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayEffect.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerRingBuffer.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class AActor;
+class UAbilitySystemComponent;
+
+enum class EKaosEffectTimelineEvent : uint8
+{
+	Applied,
+	Refreshed,
+	Stacked,
+	Periodic,
+	Removed
+};
+
+struct FKaosWorldDebugger_GameplayEffectTimeline : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_GameplayEffectTimeline();
+	virtual ~FKaosWorldDebugger_GameplayEffectTimeline();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	struct FKaosEffectTimelineEvent
+	{
+		double Time = 0.0;
+		FActiveGameplayEffectHandle Handle;
+		FName EffectName;
+		EKaosEffectTimelineEvent Type = EKaosEffectTimelineEvent::Applied;
+		/** Carried on every event so a lane can be rebuilt even after its Applied event has been overwritten */
+		double AppliedTime = 0.0;
+		int32 StackCount = 0;
+		int32 PreviousStackCount = 0;
+	};
+
+	/** Effects currently active on the bound ASC, only needed to unbind the per handle delegates */
+	struct FKaosTrackedEffect
+	{
+		FName EffectName;
+		double AppliedTime = 0.0;
+		int32 StackCount = 0;
+		FDelegateHandle StackChangeHandle;
+		FDelegateHandle TimeChangeHandle;
+	};
+
+	/** One row of the timeline, rebuilt from the events inside the visible window only */
+	struct FKaosEffectLane
+	{
+		FActiveGameplayEffectHandle Handle;
+		FName EffectName;
+		double Begin = 0.0;
+		double End = 0.0;
+		bool bOpen = true;
+		int32 MaxStacks = 1;
+		int32 Refreshes = 0;
+		int32 PeriodicExecutions = 0;
+		TArray<TPair<double, EKaosEffectTimelineEvent>> Markers;
+	};
+
+	static constexpr int32 MaxEvents = 4096;
+
+	TKaosRingBuffer<FKaosEffectTimelineEvent> Events;
+	TMap<FActiveGameplayEffectHandle, FKaosTrackedEffect> TrackedEffects;
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	/** History is kept until a different actor is selected, even after its ASC goes away */
+	TWeakObjectPtr<AActor> RecordedActor;
+	FDelegateHandle EffectAddedHandle;
+	FDelegateHandle EffectRemovedHandle;
+	FDelegateHandle PeriodicExecuteHandle;
+
+	float WindowSeconds = 60.f;
+	bool bPaused = false;
+	double PausedTime = 0.0;
+	double LastWorldTime = 0.0;
+
+	void BindToAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindFromAbilitySystem();
+	void ResetHistory();
+	void TrackEffect(UAbilitySystemComponent* AbilityComp, const FActiveGameplayEffect& ActiveGE, double Time);
+	void RecordEvent(FActiveGameplayEffectHandle Handle, EKaosEffectTimelineEvent Type, int32 PreviousStackCount = INDEX_NONE);
+	double GetWorldTime() const;
+
+	void OnActiveEffectAdded(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnActiveEffectRemoved(const FActiveGameplayEffect& ActiveGE);
+	void OnPeriodicEffectExecuted(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnEffectStackChanged(FActiveGameplayEffectHandle Handle, int32 NewStackCount, int32 PreviousStackCount);
+	void OnEffectTimeChanged(FActiveGameplayEffectHandle Handle, float NewStartTime, float NewDuration);
+
+	void BuildLanes(double StartTime, double EndTime, TArray<FKaosEffectLane>& OutLanes) const;
+	int32 FindFirstEventAfter(double Time) const;
+	void DrawTimeline(const TArray<FKaosEffectLane>& Lanes, double StartTime, double EndTime) const;
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Effect Timeline")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
@@ -0,0 +1,83 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayTagContainer.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerRingBuffer.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class UAbilitySystemComponent;
+
+struct FKaosWorldDebugger_OwnedTags : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_OwnedTags();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	static constexpr int32 MaxHistoryPerTag = 8;
+
+	struct FKaosTagCountChange
+	{
+		double Time = 0.0;
+		int32 Count = 0;
+	};
+
+	/** One explicit tag owned by the bound ASC, the per source split is only recomputed when its count changes */
+	struct FKaosOwnedTagRow
+	{
+		int32 Count = 0;
+		int32 FromEffects = 0;
+		int32 ReplicatedLoose = 0;
+		int32 MinimalReplication = 0;
+		int32 Loose = 0;
+		FDelegateHandle CountChangedHandle;
+		TKaosRingBuffer<FKaosTagCountChange> History { MaxHistoryPerTag };
+	};
+
+	TMap<FGameplayTag, FKaosOwnedTagRow> Rows;
+	TArray<FGameplayTag> SortedTags;
+	bool bSourcesDirty = false;
+	bool bSortDirty = false;
+	bool bShowRemoved = false;
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	FDelegateHandle GenericTagEventHandle;
+
+	void BindToAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindFromAbilitySystem();
+	void TrackTag(UAbilitySystemComponent* AbilityComp, const FGameplayTag& Tag);
+	double GetWorldTime() const;
+
+	void OnTagAddedOrRemoved(const FGameplayTag Tag, int32 NewCount);
+	void OnTagCountChanged(const FGameplayTag Tag, int32 NewCount);
+	void RecordCount(FKaosOwnedTagRow& Row, int32 NewCount);
+
+	void UpdateSources(const UAbilitySystemComponent* AbilityComp);
+	void DrawTagTable();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Owned Tags")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
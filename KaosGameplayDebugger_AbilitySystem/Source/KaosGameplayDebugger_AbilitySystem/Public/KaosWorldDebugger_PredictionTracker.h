@@ -0,0 +1,94 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "ActiveGameplayEffectHandle.h"
+#include "GameplayPrediction.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerHistogram.h"
+#include "KaosDebuggerRingBuffer.h"
+#include "KaosPredictionKeyTracker.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+struct FGameplayEffectSpec;
+
+struct FKaosWorldDebugger_PredictionTracker : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_PredictionTracker();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	static constexpr int32 MaxRecentRollbacks = 32;
+
+	/** Everything recorded for the keys issued by one ability class, keys issued outside of an ability share a row */
+	struct FKaosPredictionStats
+	{
+		FString AbilityName;
+		int32 Issued = 0;
+		int32 Confirmed = 0;
+		int32 Rejected = 0;
+		int32 PredictedEffects = 0;
+		int32 RolledBackEffects = 0;
+		FKaosLogHistogram IssueToConfirm;
+		FKaosLogHistogram IssueToReject;
+	};
+
+	struct FKaosRollback
+	{
+		double Time = 0.0;
+		FPredictionKey::KeyType Key = 0;
+		FString AbilityName;
+		int32 Effects = 0;
+	};
+
+	TMap<TWeakObjectPtr<UClass>, FKaosPredictionStats> PredictionStats;
+	FKaosPredictionKeyTracker KeyTracker;
+	TKaosRingBuffer<FKaosRollback> RecentRollbacks { MaxRecentRollbacks };
+	TOptional<TWeakObjectPtr<UClass>> SelectedAbilityClass;
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	FDelegateHandle ActivatedHandle;
+	FDelegateHandle EffectAddedHandle;
+
+	static UAbilitySystemComponent* FindLocallyControlledAbilitySystem(const FKaosDebuggerContext& Context);
+
+	void BindToAbilitySystem(UAbilitySystemComponent* AbilityComp);
+	void UnbindFromAbilitySystem();
+	void ResetStats();
+	FKaosInFlightPredictionKey* TrackKey(FPredictionKey PredictionKey, const UGameplayAbility* Ability);
+
+	void OnAbilityActivated(UGameplayAbility* Ability);
+	void OnEffectAdded(UAbilitySystemComponent* AbilityComp, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnKeyCaughtUp(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight);
+	void OnKeyRejected(FPredictionKey::KeyType PredictionKey, const FKaosInFlightPredictionKey& InFlight);
+
+	void DrawPredictionTable();
+	void DrawPredictionDetails();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Prediction")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
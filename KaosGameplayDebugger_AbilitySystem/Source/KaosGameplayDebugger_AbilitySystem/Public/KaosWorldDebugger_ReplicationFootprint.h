@@ -0,0 +1,90 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayEffectTypes.h"
+#include "KaosDebuggerBaseItem.h"
+#include "KaosDebuggerWorldRollup.h"
+#include "KaosWorldDebugger_AbilitySystemTypes.h"
+
+class UAbilitySystemComponent;
+
+struct FKaosWorldDebugger_ReplicationFootprint : public IKaosDebuggerBaseItem
+{
+public:
+	FKaosWorldDebugger_ReplicationFootprint();
+
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	/** What one ASC puts on the wire, byte counts are estimates from typical item sizes rather than measured */
+	struct FKaosReplicationFootprint
+	{
+		TOptional<EGameplayEffectReplicationMode> ReplicationMode;
+		int32 ActiveEffects = 0;
+		int32 EffectModifiers = 0;
+		int32 EffectGrantedTags = 0;
+		int32 ActivatableAbilities = 0;
+		int32 ReplicatedLooseTags = 0;
+		int32 MinimalReplicationTags = 0;
+		int32 AttributeSets = 0;
+		int32 ReplicatedAttributes = 0;
+		int32 OwnerBytes = 0;
+		int32 ProxyBytes = 0;
+		/** What each proxy would receive if this ASC was switched to Minimal */
+		int32 ProxyBytesIfMinimal = 0;
+		int32 EffectDeltaBytes = 0;
+	};
+
+	struct FKaosOwnerClassFootprint
+	{
+		FString OwnerClassName;
+		int32 Components = 0;
+		int32 FullReplication = 0;
+		int32 ActiveEffects = 0;
+		int32 ActivatableAbilities = 0;
+		int64 ProxyBytes = 0;
+		int64 ProxyBytesIfMinimal = 0;
+	};
+
+	struct FKaosFootprintRollup
+	{
+		TArray<FKaosOwnerClassFootprint> OwnerClasses;
+		TMap<TWeakObjectPtr<UClass>, int32> ClassIndices;
+		int32 TotalComponents = 0;
+		int64 TotalProxyBytes = 0;
+	};
+
+	TKaosWorldRollup<UAbilitySystemComponent, FKaosFootprintRollup> Rollup;
+
+	static TOptional<EGameplayEffectReplicationMode> GetReplicationMode(const UAbilitySystemComponent* AbilityComp);
+	static FKaosReplicationFootprint ComputeFootprint(const UAbilitySystemComponent* AbilityComp);
+	static void ProcessAbilitySystem(const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC, FKaosFootprintRollup& Result);
+
+	void DrawSelectedFootprint(const UAbilitySystemComponent* AbilityComp);
+	void DrawRollup();
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Replication")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
@@ -0,0 +1,89 @@
+// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "GameplayTagContainer.h"
+#include "KaosDebuggerBaseItem.h"
+
+class UAbilitySystemComponent;
+
+struct FKaosWorldDebugger_TagQuery : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_TagQuery();
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+
+private:
+	enum class EKaosTagQueryMode : uint8
+	{
+		Any,
+		All,
+		None
+	};
+
+	struct FKaosTrackedComponent
+	{
+		TWeakObjectPtr<AActor> Owner;
+		FString OwnerName;
+		FDelegateHandle TagEventHandle;
+	};
+
+	using FEntryKey = TWeakObjectPtr<UAbilitySystemComponent>;
+
+	TWeakObjectPtr<UWorld> BoundWorld;
+	TMap<FEntryKey, FKaosTrackedComponent> TrackedComponents;
+
+	/** Tag (and every parent of it) to the ASCs currently owning it, kept in sync by the generic tag event */
+	TMap<FGameplayTag, TSet<FEntryKey>> TagIndex;
+
+	FString QueryText;
+	FString AppliedQueryText;
+	int32 QueryModeIndex = 0;
+	int32 AppliedQueryModeIndex = INDEX_NONE;
+	TArray<FString> QueryModeNames = { TEXT("Match Any"), TEXT("Match All"), TEXT("Match None") };
+	bool bForceModeComboRefresh = true;
+	TArray<FString> UnknownTags;
+
+	FGameplayTagQuery Query;
+	TSet<FGameplayTag> QueryTags;
+	TSet<FEntryKey> Results;
+	TArray<FEntryKey> SortedResults;
+	bool bResultsDirty = false;
+
+	float ScanInterval = 1.f;
+	double TimeSinceLastScan = TNumericLimits<double>::Max();
+
+	void ScanWorld(UWorld* World);
+	void TrackComponent(UAbilitySystemComponent* AbilityComp);
+	void UntrackAll();
+	void RemoveFromIndex(const FEntryKey& AbilityComp);
+	void OnTagCountChanged(const FGameplayTag Tag, int32 NewCount, FEntryKey AbilityComp);
+
+	void RebuildQuery();
+	void RunQuery();
+	void EvaluateComponent(const FEntryKey& AbilityComp);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Tag Query")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+#endif
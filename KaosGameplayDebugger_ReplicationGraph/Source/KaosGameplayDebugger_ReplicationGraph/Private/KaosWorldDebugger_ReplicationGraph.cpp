@@ -0,0 +1,570 @@
+﻿// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "KaosWorldDebugger_ReplicationGraph.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "ReplicationGraph.h"
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "KaosDebuggerStats.h"
+#include "KaosSlateIMHelpers.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+#include "UObject/UnrealType.h"
+
+// Node and connection arrays are protected on the graph classes, but they are UPROPERTYs for GC so reflection can read them
+template<typename T>
+static void GetObjectArrayProperty(const UObject* Owner, FName PropertyName, TArray<T*>& OutObjects)
+{
+	const FArrayProperty* ArrayProperty = FindFProperty<FArrayProperty>(Owner->GetClass(), PropertyName);
+	if (!ArrayProperty)
+	{
+		return;
+	}
+
+	const FObjectPropertyBase* InnerProperty = CastField<FObjectPropertyBase>(ArrayProperty->Inner);
+	if (!InnerProperty)
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(Owner));
+	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+	{
+		if (T* Object = Cast<T>(InnerProperty->GetObjectPropertyValue(ArrayHelper.GetRawPtr(Index))))
+		{
+			OutObjects.Add(Object);
+		}
+	}
+}
+
+static FString GetConnectionName(const UNetReplicationGraphConnection* Connection)
+{
+	if (!Connection || !Connection->NetConnection)
+	{
+		return TEXT("None");
+	}
+	if (Connection->NetConnection->PlayerController)
+	{
+		return Connection->NetConnection->PlayerController->GetName();
+	}
+	return Connection->NetConnection->GetName();
+}
+
+FKaosWorldDebugger_ReplicationGraph::~FKaosWorldDebugger_ReplicationGraph()
+{
+	for (const auto& CachePair : CachedGraphs)
+	{
+		for (const auto& Pair : CachePair.Value.ConnectionListSizes)
+		{
+			if (UNetReplicationGraphConnection* Connection = Pair.Key.Get())
+			{
+				Connection->OnPostReplicatePrioritizeLists.Remove(Pair.Value.PrioritizeHandle);
+			}
+		}
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::DrawDetails(const FKaosDebuggerContext& Context)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::ErrorText(TEXT("No World Selected"));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	UReplicationGraph* Graph = GetReplicationGraph(World);
+	if (!Graph)
+	{
+		SlateIM::BeginVerticalStack();
+		KaosSlateIM::WarningText(TEXT("No Replication Graph active on this world's NetDriver."));
+		SlateIM::EndVerticalStack();
+		return;
+	}
+
+	FKaosRepGraphCache& Cache = CachedGraphs.FindOrAdd(World);
+	GatherGraphIfNeeded(Graph, Cache, Context.DeltaTime);
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginScrollBox();
+	SlateIM::BeginVerticalStack();
+
+	KaosSlateIM::SubHeaderText(TEXT("Graph"));
+	KaosSlateIM::DrawLabledText(TEXT("Class"), Graph->GetClass()->GetName());
+	KaosSlateIM::DrawLabledText(TEXT("Nodes"), FString::FromInt(Cache.Nodes.Num()));
+	KaosSlateIM::DrawLabledText(TEXT("Connections"), FString::FromInt(Cache.ConnectionListSizes.Num()));
+	DrawGatherCost(World);
+
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::BeginHorizontalStack();
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginVerticalStack();
+	KaosSlateIM::HeaderText(TEXT("Nodes"));
+	DrawNodeTable(Cache);
+	SlateIM::EndVerticalStack();
+
+	SlateIM::Fill();
+	SlateIM::HAlign(HAlign_Fill);
+	SlateIM::VAlign(VAlign_Fill);
+	SlateIM::BeginVerticalStack();
+	DrawSelectedNodeActors(Cache);
+	SlateIM::EndVerticalStack();
+	SlateIM::EndHorizontalStack();
+
+	KaosSlateIM::HeaderText(TEXT("Spatial Grids"));
+	DrawGridSummary(Cache);
+
+	KaosSlateIM::HeaderText(TEXT("Connections"));
+	DrawConnectionTable(Cache);
+
+	SlateIM::EndVerticalStack();
+	SlateIM::EndScrollBox();
+}
+
+void FKaosWorldDebugger_ReplicationGraph::CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines)
+{
+	UWorld* World = Context.ContextWorld.Get();
+	if (!World)
+	{
+		OutLines.Add(FKaosDebugLine::Error(TEXT("No World Selected")));
+		return;
+	}
+
+	UReplicationGraph* Graph = GetReplicationGraph(World);
+	if (!Graph)
+	{
+		OutLines.Add(FKaosDebugLine::Warning(TEXT("No Replication Graph active on this world's NetDriver.")));
+		return;
+	}
+
+	FKaosRepGraphCache& Cache = CachedGraphs.FindOrAdd(World);
+	GatherGraphIfNeeded(Graph, Cache, Context.DeltaTime);
+
+	OutLines.Add(FKaosDebugLine::Pair(TEXT("Graph"), Graph->GetClass()->GetName()));
+	for (const FKaosRepGraphNodeInfo& Info : Cache.Nodes)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(FString::Printf(TEXT("%s%s"), *FString::ChrN(Info.Depth * 2, TEXT(' ')), *Info.NodeName), FString::FromInt(Info.ActorCount)));
+	}
+
+	OutLines.Add(FKaosDebugLine::Separator());
+	for (const FKaosRepGraphGridInfo& Grid : Cache.Grids)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(Grid.NodeName, FString::Printf(TEXT("%dx%d cells of %.0f, %d occupied"), Grid.GridWidth, Grid.GridHeight, Grid.CellSize, Grid.NumOccupiedCells)));
+	}
+
+	OutLines.Add(FKaosDebugLine::Separator());
+	for (const auto& Pair : Cache.ConnectionListSizes)
+	{
+		OutLines.Add(FKaosDebugLine::Pair(Pair.Value.ConnectionName, FString::Printf(TEXT("%d prioritized (peak %d)"), Pair.Value.LastPrioritizedCount, Pair.Value.PeakPrioritizedCount)));
+	}
+}
+
+UReplicationGraph* FKaosWorldDebugger_ReplicationGraph::GetReplicationGraph(const UWorld* World)
+{
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	return NetDriver ? Cast<UReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+}
+
+void FKaosWorldDebugger_ReplicationGraph::GatherGraphIfNeeded(UReplicationGraph* Graph, FKaosRepGraphCache& Cache, float DeltaTime)
+{
+	BindConnections(Graph, Cache);
+
+	Cache.TimeSinceLastGather += DeltaTime;
+	if (Cache.Graph == Graph && Cache.TimeSinceLastGather < RefreshInterval)
+	{
+		return;
+	}
+
+	Cache.Graph = Graph;
+	Cache.TimeSinceLastGather = 0;
+	Cache.Nodes.Reset();
+	Cache.Grids.Reset();
+
+	TArray<UReplicationGraphNode*> GlobalNodes;
+	GetObjectArrayProperty(Graph, TEXT("GlobalGraphNodes"), GlobalNodes);
+	for (UReplicationGraphNode* Node : GlobalNodes)
+	{
+		GatherNode(Node, TEXT("Global"), 0, Cache);
+	}
+
+	TArray<UNetReplicationGraphConnection*> Connections;
+	GetObjectArrayProperty(Graph, TEXT("Connections"), Connections);
+	for (UNetReplicationGraphConnection* Connection : Connections)
+	{
+		TArray<UReplicationGraphNode*> ConnectionNodes;
+		GetObjectArrayProperty(Connection, TEXT("ConnectionGraphNodes"), ConnectionNodes);
+
+		const FString ConnectionName = GetConnectionName(Connection);
+		for (UReplicationGraphNode* Node : ConnectionNodes)
+		{
+			GatherNode(Node, ConnectionName, 0, Cache);
+		}
+
+		if (FKaosRepGraphListSizes* Sizes = Cache.ConnectionListSizes.Find(Connection))
+		{
+			Sizes->NumConnectionNodes = ConnectionNodes.Num();
+		}
+	}
+
+	GatherSelectedNodeActors(Cache);
+}
+
+void FKaosWorldDebugger_ReplicationGraph::GatherNode(UReplicationGraphNode* Node, const FString& Owner, int32 Depth, FKaosRepGraphCache& Cache)
+{
+	if (!Node)
+	{
+		return;
+	}
+
+	TArray<FActorRepListType> Actors;
+	Node->GetAllActorsInNode_Debugging(Actors);
+
+	FKaosRepGraphNodeInfo& Info = Cache.Nodes.AddDefaulted_GetRef();
+	Info.Node = Node;
+	Info.NodeName = Node->GetName();
+	Info.ClassName = Node->GetClass()->GetName();
+	Info.Owner = Owner;
+	Info.Depth = Depth;
+	Info.ActorCount = Actors.Num();
+
+	// Grid cells would flood the node list, they are summarized per grid instead
+	if (Node->IsA<UReplicationGraphNode_GridSpatialization2D>())
+	{
+		GatherGrid(Node, Cache);
+		return;
+	}
+
+	TArray<UReplicationGraphNode*> ChildNodes;
+	GetObjectArrayProperty(Node, TEXT("AllChildNodes"), ChildNodes);
+	for (UReplicationGraphNode* Child : ChildNodes)
+	{
+		GatherNode(Child, Owner, Depth + 1, Cache);
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::GatherGrid(UReplicationGraphNode* Node, FKaosRepGraphCache& Cache)
+{
+	UReplicationGraphNode_GridSpatialization2D* GridNode = CastChecked<UReplicationGraphNode_GridSpatialization2D>(Node);
+
+	FKaosRepGraphGridInfo& GridInfo = Cache.Grids.AddDefaulted_GetRef();
+	GridInfo.NodeName = GridNode->GetName();
+	GridInfo.CellSize = GridNode->CellSize;
+	GridInfo.SpatialBias = GridNode->SpatialBias;
+	GridInfo.GridWidth = GridNode->Grid.Num();
+
+	TArray<FKaosRepGraphCellInfo> Cells;
+	TArray<FActorRepListType> Actors;
+	for (int32 X = 0; X < GridNode->Grid.Num(); ++X)
+	{
+		const TArray<UReplicationGraphNode_GridCell*>& Column = GridNode->Grid[X];
+		GridInfo.GridHeight = FMath::Max(GridInfo.GridHeight, Column.Num());
+
+		for (int32 Y = 0; Y < Column.Num(); ++Y)
+		{
+			if (!Column[Y])
+			{
+				continue;
+			}
+
+			++GridInfo.NumCells;
+			Actors.Reset();
+			Column[Y]->GetAllActorsInNode_Debugging(Actors);
+			if (Actors.Num() > 0)
+			{
+				++GridInfo.NumOccupiedCells;
+				GridInfo.TotalCellActors += Actors.Num();
+				Cells.Add({ X, Y, Actors.Num() });
+			}
+		}
+	}
+
+	Cells.Sort([](const FKaosRepGraphCellInfo& A, const FKaosRepGraphCellInfo& B)
+	{
+		return A.ActorCount > B.ActorCount;
+	});
+	Cells.SetNum(FMath::Min(Cells.Num(), MaxBusiestCells));
+	GridInfo.BusiestCells = MoveTemp(Cells);
+}
+
+void FKaosWorldDebugger_ReplicationGraph::GatherSelectedNodeActors(FKaosRepGraphCache& Cache)
+{
+	Cache.SelectedNodeActors.Reset();
+
+	UReplicationGraphNode* Node = SelectedNode.Get();
+	if (!Node || !Cache.Nodes.ContainsByPredicate([Node](const FKaosRepGraphNodeInfo& Info) { return Info.Node == Node; }))
+	{
+		return;
+	}
+
+	TArray<FActorRepListType> Actors;
+	Node->GetAllActorsInNode_Debugging(Actors);
+	for (AActor* Actor : Actors)
+	{
+		if (!IsValid(Actor)) continue;
+
+		FKaosRepGraphActorInfo& Info = Cache.SelectedNodeActors.AddDefaulted_GetRef();
+		Info.ActorName = Actor->GetName();
+		Info.ClassName = Actor->GetClass()->GetName();
+		Info.Location = Actor->GetActorLocation();
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::BindConnections(UReplicationGraph* Graph, FKaosRepGraphCache& Cache)
+{
+	for (auto It = Cache.ConnectionListSizes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<UNetReplicationGraphConnection*> Connections;
+	GetObjectArrayProperty(Graph, TEXT("Connections"), Connections);
+	for (UNetReplicationGraphConnection* Connection : Connections)
+	{
+		if (Cache.ConnectionListSizes.Contains(Connection))
+		{
+			continue;
+		}
+
+		FKaosRepGraphListSizes& Sizes = Cache.ConnectionListSizes.Add(Connection);
+		Sizes.ConnectionName = GetConnectionName(Connection);
+		Sizes.PrioritizeHandle = Connection->OnPostReplicatePrioritizeLists.AddRaw(this, &FKaosWorldDebugger_ReplicationGraph::OnPostReplicatePrioritizeLists, TWeakObjectPtr<UWorld>(Graph->GetWorld()));
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::OnPostReplicatePrioritizeLists(UNetReplicationGraphConnection* Connection, FPrioritizedRepList* List, TWeakObjectPtr<UWorld> World)
+{
+	FKaosRepGraphCache* Cache = CachedGraphs.Find(World);
+	if (FKaosRepGraphListSizes* Sizes = Cache ? Cache->ConnectionListSizes.Find(Connection) : nullptr)
+	{
+		Sizes->LastPrioritizedCount = List ? List->Items.Num() : 0;
+		Sizes->PeakPrioritizedCount = FMath::Max(Sizes->PeakPrioritizedCount, Sizes->LastPrioritizedCount);
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::DrawNodeTable(FKaosRepGraphCache& Cache)
+{
+	SlateIM::MaxHeight(600.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Node"));
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Class"));
+	SlateIM::InitialTableColumnWidth(140.f); SlateIM::AddTableColumn(TEXT("Owner"));
+	SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Actors"));
+
+	for (const FKaosRepGraphNodeInfo& Info : Cache.Nodes)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			const FString Label = FString::ChrN(Info.Depth * 2, TEXT(' ')) + Info.NodeName;
+			if (SlateIM::Button(Label, &FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("FlatButton")))
+			{
+				SelectedNode = Info.Node;
+				GatherSelectedNodeActors(Cache);
+			}
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Info.ClassName);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Info.Owner);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(Info.ActorCount));
+		}
+	}
+
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_ReplicationGraph::DrawGridSummary(const FKaosRepGraphCache& Cache)
+{
+	if (Cache.Grids.IsEmpty())
+	{
+		SlateIM::Text(TEXT("No spatial grid nodes."));
+		return;
+	}
+
+	for (const FKaosRepGraphGridInfo& Grid : Cache.Grids)
+	{
+		KaosSlateIM::SubHeaderText(Grid.NodeName);
+		KaosSlateIM::DrawLabledText(TEXT("Cell Size"), FString::Printf(TEXT("%.0f"), Grid.CellSize));
+		KaosSlateIM::DrawLabledText(TEXT("Spatial Bias"), Grid.SpatialBias.ToString());
+		KaosSlateIM::DrawLabledText(TEXT("Grid Dimensions"), FString::Printf(TEXT("%d x %d"), Grid.GridWidth, Grid.GridHeight));
+		KaosSlateIM::DrawLabledText(TEXT("Allocated Cells"), FString::FromInt(Grid.NumCells));
+		KaosSlateIM::DrawLabledText(TEXT("Occupied Cells"), FString::FromInt(Grid.NumOccupiedCells));
+		KaosSlateIM::DrawLabledText(TEXT("Avg Actors / Occupied Cell"), Grid.NumOccupiedCells > 0
+			? FString::Printf(TEXT("%.1f"), static_cast<float>(Grid.TotalCellActors) / Grid.NumOccupiedCells)
+			: TEXT("0"));
+
+		SlateIM::BeginTable();
+		SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Cell"));
+		SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("World Min"));
+		SlateIM::InitialTableColumnWidth(80.f);  SlateIM::AddTableColumn(TEXT("Actors"));
+
+		for (const FKaosRepGraphCellInfo& Cell : Grid.BusiestCells)
+		{
+			if (SlateIM::NextTableCell())
+			{
+				SlateIM::Text(FString::Printf(TEXT("%d, %d"), Cell.X, Cell.Y));
+			}
+			if (SlateIM::NextTableCell())
+			{
+				const FVector2D CellMin = FVector2D(Cell.X, Cell.Y) * Grid.CellSize + Grid.SpatialBias;
+				SlateIM::Text(CellMin.ToString());
+			}
+			if (SlateIM::NextTableCell())
+			{
+				SlateIM::Text(FString::FromInt(Cell.ActorCount));
+			}
+		}
+
+		SlateIM::EndTable();
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::DrawConnectionTable(FKaosRepGraphCache& Cache)
+{
+	if (Cache.ConnectionListSizes.IsEmpty())
+	{
+		SlateIM::Text(TEXT("No client connections."));
+		return;
+	}
+
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Connection"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Conn. Nodes"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Prioritized"));
+	SlateIM::InitialTableColumnWidth(100.f); SlateIM::AddTableColumn(TEXT("Peak"));
+
+	for (const auto& Pair : Cache.ConnectionListSizes)
+	{
+		const FKaosRepGraphListSizes& Sizes = Pair.Value;
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Sizes.ConnectionName);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(Sizes.NumConnectionNodes));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(Sizes.LastPrioritizedCount));
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(FString::FromInt(Sizes.PeakPrioritizedCount));
+		}
+	}
+
+	SlateIM::EndTable();
+
+	if (SlateIM::Button(TEXT("Reset Peaks")))
+	{
+		for (auto& Pair : Cache.ConnectionListSizes)
+		{
+			Pair.Value.PeakPrioritizedCount = Pair.Value.LastPrioritizedCount;
+		}
+	}
+}
+
+void FKaosWorldDebugger_ReplicationGraph::DrawSelectedNodeActors(const FKaosRepGraphCache& Cache)
+{
+	UReplicationGraphNode* Node = SelectedNode.Get();
+	if (!Node)
+	{
+		SlateIM::Text(TEXT("Select a node to list its actors."));
+		return;
+	}
+
+	KaosSlateIM::HeaderText(FString::Printf(TEXT("%s (%d)"), *Node->GetName(), Cache.SelectedNodeActors.Num()));
+
+	SlateIM::MaxHeight(600.f);
+	SlateIM::BeginTable();
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Actor"));
+	SlateIM::InitialTableColumnWidth(200.f); SlateIM::AddTableColumn(TEXT("Class"));
+	SlateIM::InitialTableColumnWidth(260.f); SlateIM::AddTableColumn(TEXT("Location"));
+
+	for (const FKaosRepGraphActorInfo& Info : Cache.SelectedNodeActors)
+	{
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Info.ActorName);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Info.ClassName);
+		}
+		if (SlateIM::NextTableCell())
+		{
+			SlateIM::Text(Info.Location.ToCompactString());
+		}
+	}
+
+	SlateIM::EndTable();
+}
+
+void FKaosWorldDebugger_ReplicationGraph::DrawGatherCost(const UWorld* World)
+{
+	if (!KaosDebuggerStats::AreStatsAvailable())
+	{
+		KaosSlateIM::DrawLabledText(TEXT("Replicate Cost"), TEXT("Stats are compiled out"));
+		return;
+	}
+
+	// The graph runs inside the net driver's ServerReplicateActors scope, so that stat is its per-frame gather + replicate cost
+	FKaosStatValue Value;
+	if (KaosDebuggerStats::FindStat(TEXT("STAT_NetServerRepActorsTime"), Value))
+	{
+		KaosSlateIM::DrawLabledText(TEXT("Replicate Cost"), FString::Printf(TEXT("%.3f ms (max %.3f ms)"), Value.Average, Value.Max));
+		return;
+	}
+
+	SlateIM::BeginHorizontalStack();
+	KaosSlateIM::DrawLabledText(TEXT("Replicate Cost"), TEXT("Enable 'stat Net'"));
+	if (SlateIM::Button(TEXT("Enable")) && GEngine)
+	{
+		GEngine->Exec(const_cast<UWorld*>(World), TEXT("stat Net"));
+	}
+	SlateIM::EndHorizontalStack();
+}
+
+FSlateIcon FKaosWorldDebugger_ReplicationGraph::GetTabIcon() const
+{
+	static const FSlateIcon MyIcon = FSlateIcon(FAppStyle::GetAppStyleSetName(), "GraphEditor.EventGraph_16x");
+
+	return MyIcon;
+}
+#endif
@@ -0,0 +1,123 @@
+﻿// Copyright (C) 2025, Daniel Moss
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#if WITH_KAOS_GAMEPLAYDEBUGGER
+#include "KaosDebuggerBaseItem.h"
+
+class UReplicationGraph;
+class UReplicationGraphNode;
+class UNetReplicationGraphConnection;
+struct FPrioritizedRepList;
+
+struct FKaosWorldDebugger_ReplicationGraph : public IKaosDebuggerBaseItem
+{
+public:
+	virtual ~FKaosWorldDebugger_ReplicationGraph();
+
+	virtual void DrawDetails(const FKaosDebuggerContext& Context) override;
+	virtual void CollectSnapshot(const FKaosDebuggerContext& Context, TArray<FKaosDebugLine>& OutLines) override;
+
+private:
+	struct FKaosRepGraphNodeInfo
+	{
+		TWeakObjectPtr<UReplicationGraphNode> Node;
+		FString NodeName;
+		FString ClassName;
+		FString Owner;
+		int32 Depth = 0;
+		int32 ActorCount = 0;
+	};
+
+	struct FKaosRepGraphCellInfo
+	{
+		int32 X = 0;
+		int32 Y = 0;
+		int32 ActorCount = 0;
+	};
+
+	struct FKaosRepGraphGridInfo
+	{
+		FString NodeName;
+		float CellSize = 0.f;
+		FVector2D SpatialBias = FVector2D::ZeroVector;
+		int32 GridWidth = 0;
+		int32 GridHeight = 0;
+		int32 NumCells = 0;
+		int32 NumOccupiedCells = 0;
+		int32 TotalCellActors = 0;
+		TArray<FKaosRepGraphCellInfo> BusiestCells;
+	};
+
+	struct FKaosRepGraphListSizes
+	{
+		FString ConnectionName;
+		int32 NumConnectionNodes = 0;
+		int32 LastPrioritizedCount = 0;
+		int32 PeakPrioritizedCount = 0;
+		FDelegateHandle PrioritizeHandle;
+	};
+
+	struct FKaosRepGraphActorInfo
+	{
+		FString ActorName;
+		FString ClassName;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	struct FKaosRepGraphCache
+	{
+		TWeakObjectPtr<UReplicationGraph> Graph;
+		TArray<FKaosRepGraphNodeInfo> Nodes;
+		TArray<FKaosRepGraphGridInfo> Grids;
+		TArray<FKaosRepGraphActorInfo> SelectedNodeActors;
+		double TimeSinceLastGather = TNumericLimits<double>::Max();
+
+		/** Filled from each connection's prioritize callback, so sizes are exactly what the graph sent last frame */
+		TMap<TWeakObjectPtr<UNetReplicationGraphConnection>, FKaosRepGraphListSizes> ConnectionListSizes;
+	};
+
+	TMap<TWeakObjectPtr<UWorld>, FKaosRepGraphCache> CachedGraphs;
+
+	TWeakObjectPtr<UReplicationGraphNode> SelectedNode;
+	float RefreshInterval = .5f;
+	int32 MaxBusiestCells = 10;
+
+	static UReplicationGraph* GetReplicationGraph(const UWorld* World);
+	void GatherGraphIfNeeded(UReplicationGraph* Graph, FKaosRepGraphCache& Cache, float DeltaTime);
+	void GatherNode(UReplicationGraphNode* Node, const FString& Owner, int32 Depth, FKaosRepGraphCache& Cache);
+	void GatherGrid(UReplicationGraphNode* Node, FKaosRepGraphCache& Cache);
+	void GatherSelectedNodeActors(FKaosRepGraphCache& Cache);
+	void BindConnections(UReplicationGraph* Graph, FKaosRepGraphCache& Cache);
+	void OnPostReplicatePrioritizeLists(UNetReplicationGraphConnection* Connection, FPrioritizedRepList* List, TWeakObjectPtr<UWorld> World);
+
+	void DrawNodeTable(FKaosRepGraphCache& Cache);
+	void DrawGridSummary(const FKaosRepGraphCache& Cache);
+	void DrawConnectionTable(FKaosRepGraphCache& Cache);
+	void DrawSelectedNodeActors(const FKaosRepGraphCache& Cache);
+	void DrawGatherCost(const UWorld* World);
+
+public:
+	virtual FText GetTabLabel() const override { return FText::FromString(TEXT("Replication Graph")); }
+	virtual FSlateIcon GetTabIcon() const override;;
+};
+
+#endif